@@ -11,6 +11,7 @@ macro(configure_project)
     option(FASTCTEST "Enable fast ctest" OFF)
     option(JSONCPP "Enable jsoncpp for .json hash debugging (--showhash)" OFF)
     option(UNITTESTS "Enable complex unit tests" OFF)
+    option(ZSTD "Enable .zst compressed test files" OFF)
 
     # components
   
@@ -47,6 +48,7 @@ macro(print_config)
     message("------------------------------------------------------------------ tests")
     message("-- FASTCTEST        Run only test suites in ctest            ${FASTCTEST}")
     message("-- JSONCPP          Compile with jsoncpp for debug           ${JSONCPP}")
+    message("-- ZSTD             Compile with zstd compressed tests       ${ZSTD}")
     message("-- TESTETH_ARGS     Testeth arguments in ctest:               ")
     message("                    ${TESTETH_ARGS}")
     message("------------------------------------------------------------------------")
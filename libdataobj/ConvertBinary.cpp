@@ -0,0 +1,189 @@
+#include "ConvertBinary.h"
+#include "Exception.h"
+#include <cstring>
+#include <unordered_map>
+using namespace std;
+using namespace dataobject;
+
+namespace
+{
+// magic + format version
+char const c_header[] = {'R', 'T', 'D', 'O', 1};
+
+// Layout (little endian):
+//   header | u32 keys count | (u32 length, bytes) per key | root node
+//   node: u8 DataType | u32 key index | value
+//   value: Bool u8 | String u32 length, bytes | Integer i32 | Object, Array u8 autosort, u32 count, nodes
+class BinaryWriter
+{
+public:
+    string write(DataObject const& _input)
+    {
+        collectKeys(_input);
+        m_out.append(c_header, sizeof(c_header));
+        writeU32(m_keys.size());
+        for (auto const* key : m_keys)
+            writeString(*key);
+        writeNode(_input);
+        return std::move(m_out);
+    }
+
+private:
+    void collectKeys(DataObject const& _obj)
+    {
+        if (m_keyIndex.emplace(_obj.getKey(), m_keys.size()).second)
+            m_keys.emplace_back(&_obj.getKey());
+        for (auto const& el : _obj.getSubObjects())
+            collectKeys(el.getCContent());
+    }
+
+    void writeU32(size_t _value)
+    {
+        if (_value > UINT32_MAX)
+            throw DataObjectException() << "DataObject is too big for binary format";
+        uint32_t const value = _value;
+        for (size_t i = 0; i < 4; i++)
+            m_out.push_back(char((value >> (8 * i)) & 0xff));
+    }
+
+    void writeString(string const& _str)
+    {
+        writeU32(_str.size());
+        m_out.append(_str);
+    }
+
+    void writeNode(DataObject const& _obj)
+    {
+        m_out.push_back(char(_obj.type()));
+        writeU32(m_keyIndex.at(_obj.getKey()));
+        switch (_obj.type())
+        {
+        case DataType::Bool: m_out.push_back(char(_obj.asBool())); break;
+        case DataType::String: writeString(_obj.asString()); break;
+        case DataType::Integer: writeU32(uint32_t(_obj.asInt())); break;
+        case DataType::Object:
+        case DataType::Array:
+            m_out.push_back(char(_obj.isAutosort()));
+            writeU32(_obj.getSubObjects().size());
+            for (auto const& el : _obj.getSubObjects())
+                writeNode(el.getCContent());
+            break;
+        default: break;
+        }
+    }
+
+    string m_out;
+    std::vector<string const*> m_keys;
+    std::unordered_map<string, size_t> m_keyIndex;
+};
+
+class BinaryReader
+{
+public:
+    BinaryReader(char const* _data, size_t _size) : m_pos(_data), m_end(_data + _size) {}
+    spDataObject read()
+    {
+        require(sizeof(c_header));
+        if (memcmp(m_pos, c_header, sizeof(c_header)) != 0)
+            throw DataObjectException() << "Binary DataObject has wrong header";
+        m_pos += sizeof(c_header);
+
+        size_t const keys = readU32();
+        m_keys.reserve(keys);
+        for (size_t i = 0; i < keys; i++)
+            m_keys.emplace_back(readString());
+        spDataObject res = readNode();
+        if (m_pos != m_end)
+            throw DataObjectException() << "Binary DataObject has trailing data";
+        return res;
+    }
+
+private:
+    void require(size_t _bytes) const
+    {
+        if (size_t(m_end - m_pos) < _bytes)
+            throw DataObjectException() << "Binary DataObject is truncated";
+    }
+
+    uint8_t readU8()
+    {
+        require(1);
+        return uint8_t(*m_pos++);
+    }
+
+    uint32_t readU32()
+    {
+        require(4);
+        uint32_t value = 0;
+        for (size_t i = 0; i < 4; i++)
+            value |= uint32_t(uint8_t(m_pos[i])) << (8 * i);
+        m_pos += 4;
+        return value;
+    }
+
+    string readString()
+    {
+        size_t const size = readU32();
+        require(size);
+        string res(m_pos, size);
+        m_pos += size;
+        return res;
+    }
+
+    spDataObject readNode()
+    {
+        uint8_t const type = readU8();
+        size_t const keyIndex = readU32();
+        if (keyIndex >= m_keys.size())
+            throw DataObjectException() << "Binary DataObject has wrong key index";
+
+        spDataObject obj;
+        switch (type)
+        {
+        case DataType::NotInitialized: throw DataObjectException() << "Binary DataObject has an uninitialized node";
+        case DataType::Null: obj = sDataObject(DataType::Null); break;
+        case DataType::Bool: obj = sDataObject(DataType::Bool, readU8() != 0); break;
+        case DataType::String: obj = sDataObject(readString()); break;
+        case DataType::Integer: obj = sDataObject(int(readU32())); break;
+        case DataType::Object:
+        case DataType::Array:
+        {
+            bool const isObject = type == DataType::Object;
+            obj = sDataObject(DataType(type));
+            (*obj).setAutosort(readU8() != 0);
+            size_t const count = readU32();
+            for (size_t i = 0; i < count; i++)
+            {
+                spDataObject el = readNode();
+                if (isObject)
+                    (*obj).addSubObject(el);
+                else
+                    (*obj).addArrayObject(el);
+            }
+            break;
+        }
+        default: throw DataObjectException() << "Binary DataObject has wrong type " + to_string(type);
+        }
+        if (!m_keys.at(keyIndex).empty())
+            (*obj).setKey(m_keys.at(keyIndex));
+        return obj;
+    }
+
+    char const* m_pos;
+    char const* m_end;
+    std::vector<string> m_keys;
+};
+}  // namespace
+
+namespace dataobject
+{
+string ConvertDataToBinary(DataObject const& _input)
+{
+    return BinaryWriter().write(_input);
+}
+
+spDataObject ConvertBinaryToData(char const* _data, size_t _size)
+{
+    return BinaryReader(_data, _size).read();
+}
+}  // namespace dataobject
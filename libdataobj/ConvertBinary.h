@@ -0,0 +1,12 @@
+#pragma once
+#include "DataObject.h"
+
+namespace dataobject
+{
+/// Compact binary form of DataObject tree
+/// Tagged length prefixed nodes with all keys stored once in a key table
+std::string ConvertDataToBinary(DataObject const& _input);
+
+/// Read DataObject tree from ConvertDataToBinary output, throws DataObjectException on malformed input
+spDataObject ConvertBinaryToData(char const* _data, size_t _size);
+}
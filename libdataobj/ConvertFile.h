@@ -1,5 +1,6 @@
 #pragma once
 #include "DataObject.h"
+#include <istream>
 
 namespace dataobject
 {
@@ -14,9 +15,14 @@ struct CJOptions
     JsonParse jsonParse = JsonParse::STRICT_JSON;
     bool autosort = false;
     std::string stopper = std::string();
+    KeyReplaceMap const* keyReplace = nullptr;  // rename keys while parsing
+    std::string keyReplaceScope = std::string();  // if set, rename only keys inside this root field
 };
 
 /// Convert Json object represented as string to DataObject
 spDataObject ConvertJsoncppStringToData(
     std::string const& _input, CJOptions const& _opt = CJOptions());
+
+/// Convert Json object to DataObject reading the stream through a bounded buffer
+spDataObject ConvertJsonStreamToData(std::istream& _input, CJOptions const& _opt = CJOptions());
 }
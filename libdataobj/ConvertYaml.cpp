@@ -1,8 +1,154 @@
 #include "ConvertYaml.h"
+#include <yaml-cpp/eventhandler.h>
 #include <iostream>
+#include <map>
+#include <streambuf>
 using namespace std;
+using namespace dataobject;
 using namespace dataobject::ymlinternal;
 
+namespace
+{
+// Read the string in place, without a stringstream copy
+struct StringBuf : public std::streambuf
+{
+    StringBuf(string const& _str)
+    {
+        char* begin = const_cast<char*>(_str.data());
+        setg(begin, begin, begin + _str.size());
+    }
+};
+
+// Builds DataObjects from yaml-cpp parser events
+// Containers are added to the parent when complete, as ConvertYamlToData does
+class DataObjectBuilder : public YAML::EventHandler
+{
+public:
+    DataObjectBuilder(bool _sort) : m_sort(_sort) {}
+    spDataObject result() const { return m_root.isEmpty() ? sDataObject(DataType::Null) : m_root; }
+
+    void OnDocumentStart(YAML::Mark const&) override {}
+    void OnDocumentEnd() override {}
+    void OnNull(YAML::Mark const& _mark, YAML::anchor_t _anchor) override
+    {
+        add(_mark, sDataObject(DataType::Null), _anchor);
+    }
+    void OnAlias(YAML::Mark const& _mark, YAML::anchor_t _anchor) override
+    {
+        auto const it = m_anchors.find(_anchor);
+        if (it == m_anchors.end())
+            throw DataObjectException() << "parsing .yml encountered alias to incomplete node" + line(_mark);
+        if (expectsKey() && it->second->type() == DataType::String)
+            setKey(_mark, it->second->asString());
+        else
+            add(_mark, it->second->copy(), 0);
+    }
+    void OnScalar(YAML::Mark const& _mark, string const& _tag, YAML::anchor_t _anchor, string const& _value) override
+    {
+        // Map keys are taken as written, whatever the tag
+        if (expectsKey())
+        {
+            if (_anchor != 0)
+                m_anchors[_anchor] = sDataObject(_value);
+            setKey(_mark, _value);
+            return;
+        }
+
+        if (_tag == YML_INT_TAG)
+            add(_mark, sDataObject(YAML::Node(_value).as<int>()), _anchor);
+        else if (_tag == YML_BOOL_TAG)
+            add(_mark, sDataObject(DataType::Bool, YAML::Node(_value).as<bool>()), _anchor);
+        else
+            add(_mark, sDataObject(_value), _anchor);
+    }
+    void OnSequenceStart(YAML::Mark const& _mark, string const&, YAML::anchor_t _anchor, YAML::EmitterStyle::value) override
+    {
+        open(_mark, DataType::Array, _anchor);
+    }
+    void OnSequenceEnd() override { close(); }
+    void OnMapStart(YAML::Mark const& _mark, string const&, YAML::anchor_t _anchor, YAML::EmitterStyle::value) override
+    {
+        open(_mark, DataType::Object, _anchor);
+    }
+    void OnMapEnd() override { close(); }
+
+private:
+    struct Frame
+    {
+        spDataObject obj;
+        YAML::Mark mark;
+        YAML::anchor_t anchor;
+        bool isMap;
+        bool hasKey = false;
+        string key;
+        YAML::Mark keyMark;
+    };
+
+    static string line(YAML::Mark const& _mark) { return " (line " + to_string(_mark.line + 1) + ")"; }
+
+    bool expectsKey() const { return !m_stack.empty() && m_stack.back().isMap && !m_stack.back().hasKey; }
+    void setKey(YAML::Mark const& _mark, string const& _key)
+    {
+        Frame& frame = m_stack.back();
+        frame.key = _key;
+        frame.keyMark = _mark;
+        frame.hasKey = true;
+    }
+
+    void open(YAML::Mark const& _mark, DataType _type, YAML::anchor_t _anchor)
+    {
+        if (expectsKey())
+            throw DataObjectException() << "parsing .yml encountered not a scalar map key" + line(_mark);
+        spDataObject obj = sDataObject(_type);
+        if (m_sort)
+            (*obj).setAutosort(true);
+        m_stack.push_back({obj, _mark, _anchor, _type == DataType::Object, false, string(), _mark});
+    }
+
+    void close()
+    {
+        Frame frame = std::move(m_stack.back());
+        m_stack.pop_back();
+        add(frame.mark, frame.obj, frame.anchor);
+    }
+
+    void add(YAML::Mark const& _mark, spDataObject _obj, YAML::anchor_t _anchor)
+    {
+        if (_anchor != 0)
+            m_anchors[_anchor] = _obj;
+        if (m_stack.empty())
+        {
+            if (m_root.isEmpty())
+                m_root = _obj;
+            return;
+        }
+
+        Frame& frame = m_stack.back();
+        if (frame.isMap)
+        {
+            if (!frame.hasKey)
+                throw DataObjectException() << "parsing .yml encountered not a scalar map key" + line(_mark);
+            if (frame.obj->count(frame.key))
+                throw DataObjectException()
+                    << "parsing .yml encountered dublicated key `" + frame.key + "`" + line(frame.keyMark);
+            (*frame.obj).addSubObject(std::move(frame.key), _obj);
+            frame.key = string();
+            frame.hasKey = false;
+        }
+        else
+        {
+            (*_obj).setKey(string());
+            (*frame.obj).addArrayObject(_obj);
+        }
+    }
+
+    bool m_sort;
+    spDataObject m_root = spDataObject(0);
+    std::vector<Frame> m_stack;
+    std::map<YAML::anchor_t, spDataObject> m_anchors;
+};
+}  // namespace
+
 namespace dataobject
 {
 
@@ -74,4 +220,19 @@ spDataObject ConvertYamlToData(YAML::Node const& _node, bool _sort)
     return sDataObject(DataType::Null);
 }
 
+spDataObject ConvertYamlStringToData(std::string const& _input, bool _sort)
+{
+    StringBuf buf(_input);
+    std::istream stream(&buf);
+    return ConvertYamlStreamToData(stream, _sort);
+}
+
+spDataObject ConvertYamlStreamToData(std::istream& _input, bool _sort)
+{
+    YAML::Parser parser(_input);
+    DataObjectBuilder builder(_sort);
+    parser.HandleNextDocument(builder);
+    return builder.result();
+}
+
 }//namespace
@@ -9,6 +9,11 @@ std::string yamlTypeAsString(YAML::NodeType::value _type);
 /// Convert Yaml object to DataObject
 spDataObject ConvertYamlToData(YAML::Node const& _input, bool _sort = false);
 
+/// Convert Yaml text to DataObject directly from parser events, without a YAML::Node tree
+/// Same result as ConvertYamlToData(YAML::Load(_input), _sort)
+spDataObject ConvertYamlStringToData(std::string const& _input, bool _sort = false);
+spDataObject ConvertYamlStreamToData(std::istream& _input, bool _sort = false);
+
 namespace ymlinternal {
 extern const std::string YML_INT_TAG;
 extern const std::string YML_BOOL_TAG;
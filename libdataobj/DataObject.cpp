@@ -427,8 +427,19 @@ std::string DataObject::asJsonNoFirstKey() const
     return asJson(0, true, true);
 }
 
-std::string DataObject::asJson(int level, bool pretty, bool nokey) const
+std::string const& dataobject::replacedKey(std::string const& _key, KeyReplaceMap const* _keyReplace)
 {
+    if (_keyReplace == nullptr || _key.empty())
+        return _key;
+    auto const it = _keyReplace->find(_key);
+    if (it == _keyReplace->end())
+        return _key;
+    return it->second;
+}
+
+std::string DataObject::asJson(int level, bool pretty, bool nokey, KeyReplaceMap const* _keyReplace) const
+{
+    std::string const& key = replacedKey(m_strKey, _keyReplace);
     std::ostringstream out;
     auto printLevel = [level, pretty, &out]() -> void {
         if (pretty)
@@ -436,7 +447,7 @@ std::string DataObject::asJson(int level, bool pretty, bool nokey) const
                 out << " ";
     };
 
-    auto printElements = [this, &out, level, pretty]() -> void {
+    auto printElements = [this, &out, level, pretty, _keyReplace]() -> void {
         if (this->isArray())
         {
             auto const& subObjects = getSubObjects();
@@ -446,7 +457,7 @@ std::string DataObject::asJson(int level, bool pretty, bool nokey) const
                 if ((*it).isEmpty())
                     out << "NaN";
                 else
-                    out << (*it)->asJson(level + 1, pretty);
+                    out << (*it)->asJson(level + 1, pretty, false, _keyReplace);
                 if (it + 1 != subObjects.end())
                     out << ",";
                 if (pretty)
@@ -460,35 +471,35 @@ std::string DataObject::asJson(int level, bool pretty, bool nokey) const
     {
     case DataType::NotInitialized:
         printLevel();
-        if (!m_strKey.empty() && !nokey)
+        if (!key.empty() && !nokey)
         {
             if (pretty)
-                out << "\"" << m_strKey << "\" : ";
+                out << "\"" << key << "\" : ";
             else
-                out << "\"" << m_strKey << "\":";
+                out << "\"" << key << "\":";
         }
         out << "notinit";
         break;
     case DataType::Null:
         printLevel();
-        if (!m_strKey.empty() && !nokey)
+        if (!key.empty() && !nokey)
         {
             if (pretty)
-                out << "\"" << m_strKey << "\" : ";
+                out << "\"" << key << "\" : ";
             else
-                out << "\"" << m_strKey << "\":";
+                out << "\"" << key << "\":";
         }
         out << "null";
         //out << "{}";  // why???
         break;
     case DataType::Object:
-        if (!m_strKey.empty() && !nokey)
+        if (!key.empty() && !nokey)
         {
             printLevel();
             if (pretty)
-                out << "\"" << m_strKey << "\" : {" << std::endl;
+                out << "\"" << key << "\" : {" << std::endl;
             else
-                out << "\"" << m_strKey << "\":{";
+                out << "\"" << key << "\":{";
         }
         else
         {
@@ -502,13 +513,13 @@ std::string DataObject::asJson(int level, bool pretty, bool nokey) const
         out << "}";
         break;
     case DataType::Array:
-        if (!m_strKey.empty() && !nokey)
+        if (!key.empty() && !nokey)
         {
             printLevel();
             if (pretty)
-                out << "\"" << m_strKey << "\" : [" << std::endl;
+                out << "\"" << key << "\" : [" << std::endl;
             else
-                out << "\"" << m_strKey << "\":[";
+                out << "\"" << key << "\":[";
         }
         else
         {
@@ -525,13 +536,13 @@ std::string DataObject::asJson(int level, bool pretty, bool nokey) const
         printLevel();
         if (pretty)
         {
-            if (!m_strKey.empty() && !nokey)
-                out << "\"" << m_strKey << "\" : ";
+            if (!key.empty() && !nokey)
+                out << "\"" << key << "\" : ";
         }
         else
         {
-            if (!m_strKey.empty() && !nokey)
-                out << "\"" << m_strKey << "\":";
+            if (!key.empty() && !nokey)
+                out << "\"" << key << "\":";
         }
 
         //  threat special chars
@@ -548,23 +559,23 @@ std::string DataObject::asJson(int level, bool pretty, bool nokey) const
         break;
     case DataType::Integer:
         printLevel();
-        if (!m_strKey.empty() && !nokey)
+        if (!key.empty() && !nokey)
         {
             if (pretty)
-                out << "\"" << m_strKey << "\" : ";
+                out << "\"" << key << "\" : ";
             else
-                out << "\"" << m_strKey << "\":";
+                out << "\"" << key << "\":";
         }
         out << std::get<int>(m_value);;
         break;
     case DataType::Bool:
         printLevel();
-        if (!m_strKey.empty() && !nokey)
+        if (!key.empty() && !nokey)
         {
             if (pretty)
-                out << "\"" << m_strKey << "\" : ";
+                out << "\"" << key << "\" : ";
             else
-                out << "\"" << m_strKey << "\":";
+                out << "\"" << key << "\":";
         }
         if (std::get<bool>(m_value))
             out << "true";
@@ -4,6 +4,7 @@
 #include <map>
 #include <set>
 #include <string>
+#include <unordered_map>
 #include <vector>
 #include <variant>
 
@@ -25,6 +26,10 @@ class DataObjectK;
 class GCP_SPointerDataObject;
 typedef GCP_SPointerDataObject spDataObject;
 
+// Precompiled key renaming rules (old key => new key) applied when reading/writing json
+typedef std::unordered_map<std::string, std::string> KeyReplaceMap;
+std::string const& replacedKey(std::string const& _key, KeyReplaceMap const* _keyReplace);
+
 /// DataObject
 /// A data sturcture to manage data from json, yml
 class DataObject : public GCP_SPointerBase
@@ -113,7 +118,8 @@ public:
     void clear(DataType _type = DataType::NotInitialized);
 
     std::string asJsonNoFirstKey() const;
-    std::string asJson(int level = 0, bool pretty = true, bool nokey = false) const;
+    std::string asJson(int level = 0, bool pretty = true, bool nokey = false,
+        KeyReplaceMap const* _keyReplace = nullptr) const;
     static std::string dataTypeAsString(DataType _type);
 
     constexpr void setAutosort(bool _sort) { m_autosort = _sort; }
@@ -1,19 +1,105 @@
 #include "JsonParser.h"
 #include "Exception.h"
 #include <algorithm>
+#include <cstring>
 #include <fstream>
 #include <iostream>
 
 using namespace std;
 using namespace dataobject;
 
+namespace
+{
+size_t const c_chunkSize = 64 * 1024;
+size_t const c_keepSize = 256;  // kept before the released position for error context
+}
+
+JsonInput::JsonInput(std::string const& _input) : m_data(_input.data()), m_end(_input.size()) {}
+JsonInput::JsonInput(std::istream& _input) : m_stream(&_input) {}
+
+bool JsonInput::fill(size_t _i)
+{
+    if (m_stream == nullptr)
+        return false;
+    while (m_end <= _i && m_stream->good())
+    {
+        size_t const size = m_buffer.size();
+        m_buffer.resize(size + c_chunkSize);
+        m_stream->read(&m_buffer[size], c_chunkSize);
+        m_buffer.resize(size + m_stream->gcount());
+        m_end = m_offset + m_buffer.size();
+    }
+    m_data = m_buffer.data();
+    if (m_stream->bad())
+        throw DataObjectException() << "Error parsing json: could not read the input stream";
+    return _i < m_end;
+}
+
+char JsonInput::at(size_t _i)
+{
+    if (_i < m_offset)
+        throw DataObjectException() << "Error parsing json: position is out of the read window";
+    if (!has(_i))
+        throw DataObjectException() << "Error parsing json: unexpected end of json";
+    return m_data[_i - m_offset];
+}
+
+size_t JsonInput::find(char _c, size_t _from)
+{
+    size_t pos = std::max(_from, m_offset);
+    while (has(pos))
+    {
+        void const* found = memchr(m_data + (pos - m_offset), _c, m_end - pos);
+        if (found != nullptr)
+            return m_offset + (static_cast<char const*>(found) - m_data);
+        pos = m_end;
+    }
+    return string::npos;
+}
+
+string JsonInput::substr(size_t _pos, size_t _len)
+{
+    _pos = std::max(_pos, m_offset);
+    if (_len == 0 || !has(_pos))
+        return string();
+    has(_pos + _len - 1);
+    size_t const end = std::min(_pos + _len, m_end);
+    return string(m_data + (_pos - m_offset), end - _pos);
+}
+
+void JsonInput::release(size_t _i)
+{
+    // Drop the read data in big pieces, keep the last not empty char for the excessive comma check
+    if (m_stream == nullptr || _i < m_offset + c_chunkSize + c_keepSize)
+        return;
+    size_t keep = _i - c_keepSize;
+    while (keep > m_offset && isspace(static_cast<unsigned char>(m_data[keep - m_offset])))
+        keep--;
+    m_buffer.erase(0, keep - m_offset);
+    m_offset = keep;
+    m_data = m_buffer.data();
+}
+
 JsonParser::JsonParser(std::string const& _input, CJOptions const& _opt)
   : m_input(_input), m_opt(_opt)
 {
     if (_input.size() < 2 || _input.find("{") == string::npos || _input.rfind("}") == string::npos)
         throw DataObjectException() << "ConvertJsoncppStringToData can't read json structure in file: `" + _input.substr(0, 50);
+    init();
+}
+
+JsonParser::JsonParser(std::istream& _input, CJOptions const& _opt)
+  : m_input(_input), m_opt(_opt)
+{
+    size_t const begin = skipSpaces(0);
+    if (!m_input.has(begin + 1) || (m_input.at(begin) != '{' && m_input.at(begin) != '['))
+        throw DataObjectException() << "ConvertJsoncppStringToData can't read json structure in file: `" + m_input.substr(0, 50);
+    init();
+}
 
-    m_root.getContent().setAutosort(_opt.autosort);
+void JsonParser::init()
+{
+    m_root.getContent().setAutosort(m_opt.autosort);
     m_actualRoot = &m_root.getContent();
 }
 
@@ -30,11 +116,12 @@ string JsonParser::printDebug(size_t const& _i)
 
 void JsonParser::parse()
 {
-    for (size_t i = 0; i < m_input.length(); i++)
+    for (size_t i = 0; m_input.has(i); i++)
     {
+        m_input.release(i);
         bool isSeenCommaBefore = checkExcessiveComaBefore(i);
         i = skipSpaces(i);
-        if (i == m_input.length())
+        if (!m_input.has(i))
             throw DataObjectException() << errorPrefix + "unexpected end of json! around: " + printDebug(i);
 
         if (tryParseKeyValue(i) == RET::CONTINUE)
@@ -55,6 +142,18 @@ void JsonParser::parse()
     }
 }
 
+bool JsonParser::isKeyReplaceScope() const
+{
+    if (m_opt.keyReplaceScope.empty())
+        return true;
+    if (m_applyDepth.empty())
+        return false;
+
+    // The root field that we are reading into
+    DataObject const* rootField = m_applyDepth.size() == 1 ? m_actualRoot : m_applyDepth.at(1);
+    return rootField->getKey() == m_opt.keyReplaceScope;
+}
+
 JsonParser::RET JsonParser::tryParseKeyValue(size_t& _i)
 {
     const bool escapeChar = (_i > 0 && m_input.at(_i - 1) == '\\');
@@ -65,6 +164,12 @@ JsonParser::RET JsonParser::tryParseKeyValue(size_t& _i)
         _i = skipSpaces(_i);
         if (m_input.at(_i) == ':')
         {
+            if (m_opt.keyReplace != nullptr && isKeyReplaceScope())
+            {
+                auto const it = m_opt.keyReplace->find(key);
+                if (it != m_opt.keyReplace->end())
+                    key = it->second;
+            }
             if (m_keyEncountered)
                 throw DataObjectException() << errorPrefix + "attempt to set key multiple times! "
                                   "(like \"key\" : \"key\" : \"value\") around: " + printDebug(_i);
@@ -177,8 +282,8 @@ JsonParser::RET JsonParser::tryParseArrayEnd(size_t& _i, bool _seenCommaBefore)
         {
             _i++;
             _i = skipSpaces(_i);
-            if (_i != m_input.length())
-                throw DataObjectException() << errorPrefix + "expected end of json! " + m_input;
+            if (m_input.has(_i))
+                throw DataObjectException() << errorPrefix + "expected end of json! around: " + printDebug(_i);
             return RET::RETURN;
         }
         else
@@ -186,7 +291,7 @@ JsonParser::RET JsonParser::tryParseArrayEnd(size_t& _i, bool _seenCommaBefore)
             m_actualRoot = m_applyDepth.at(m_applyDepth.size() - 1);
             m_applyDepth.pop_back();
 
-            if (_i + 1 < m_input.length())
+            if (m_input.has(_i + 1))
             {
                 if (m_input.at(_i + 1) == ',')
                 {
@@ -254,20 +359,22 @@ bool JsonParser::isEmptyChar(char const& _char) const
     return std::any_of(std::begin(emptyChars), std::end(emptyChars), [_char](char c) { return c == _char; });
 }
 
-size_t JsonParser::skipSpaces(size_t const& _i) const
+size_t JsonParser::skipSpaces(size_t const& _i)
 {
-    auto const it = std::find_if_not(m_input.begin() + _i, m_input.end(), [this](char c) { return isEmptyChar(c); });
-    return std::distance(m_input.begin(), it);
+    size_t i = _i;
+    while (m_input.has(i) && isEmptyChar(m_input[i]))
+        i++;
+    return i;
 }
 
-string JsonParser::parseKeyValue(size_t& _i) const
+string JsonParser::parseKeyValue(size_t& _i)
 {
-    if (_i + 1 > m_input.size())
+    if (!m_input.has(_i))
         throw DataObjectException() << errorPrefix + "reached EOF before reading char: `\"`";
 
     bool escapeChar = true;
     size_t endPos = m_input.find('"', _i + 1);
-    while (escapeChar)
+    while (escapeChar && endPos != string::npos)
     {
         escapeChar = (m_input[endPos - 1] == '\\');
         if (escapeChar)
@@ -285,9 +392,9 @@ string JsonParser::parseKeyValue(size_t& _i) const
     return string();
 }
 
-bool JsonParser::readBoolOrNull(size_t& _i, bool& _result, bool& _readNull) const
+bool JsonParser::readBoolOrNull(size_t& _i, bool& _result, bool& _readNull)
 {
-    if (_i + 4 >= m_input.size())
+    if (!m_input.has(_i + 4))
         return false;
 
     // true false
@@ -316,10 +423,10 @@ bool JsonParser::readBoolOrNull(size_t& _i, bool& _result, bool& _readNull) cons
     return false;
 }
 
-bool JsonParser::readDigit(size_t& _i, int& _result) const
+bool JsonParser::readDigit(size_t& _i, int& _result)
 {
     bool readMinus = false;
-    auto const& e = m_input[_i];
+    char const e = m_input[_i];
     if (e == '-')
     {
         readMinus = true;
@@ -330,7 +437,7 @@ bool JsonParser::readDigit(size_t& _i, int& _result) const
     string readNumber;
     while (digit)
     {
-        auto const& e = m_input[_i];
+        char const e = m_input[_i];
         if (e == '0' || e == '1' || e == '2' || e == '3' || e == '4' || e == '5' || e == '6' ||
             e == '7' || e == '8' || e == '9')
         {
@@ -353,7 +460,7 @@ bool JsonParser::readDigit(size_t& _i, int& _result) const
     return false;
 }
 
-bool JsonParser::checkExcessiveComaBefore(size_t const& _i) const
+bool JsonParser::checkExcessiveComaBefore(size_t const& _i)
 {
     if (_i < 1)
         return false;
@@ -1,14 +1,41 @@
 #pragma once
 #include "DataObject.h"
 #include "ConvertFile.h"
+#include <istream>
 
 namespace dataobject
 {
 
+// Json text addressed by absolute position
+// Stream input is read through a bounded window, data before release() position is dropped
+class JsonInput
+{
+public:
+    JsonInput(std::string const& _input);
+    JsonInput(std::istream& _input);
+
+    // true if position _i is inside the input, reads more from the stream when needed
+    bool has(size_t _i) { return _i < m_end || fill(_i); }
+    char at(size_t _i);
+    char operator[](size_t _i) { return _i >= m_offset && has(_i) ? m_data[_i - m_offset] : '\0'; }
+    size_t find(char _c, size_t _from);
+    std::string substr(size_t _pos, size_t _len);
+    void release(size_t _i);
+
+private:
+    bool fill(size_t _i);
+    std::istream* m_stream = nullptr;
+    std::string m_buffer;
+    char const* m_data = nullptr;
+    size_t m_offset = 0;  // absolute position of m_data[0]
+    size_t m_end = 0;     // absolute position after the last read char
+};
+
 class JsonParser
 {
 public:
     JsonParser(std::string const& _input, CJOptions const& _opt = CJOptions());
+    JsonParser(std::istream& _input, CJOptions const& _opt = CJOptions());
     void parse();
     spDataObject root() { return  m_root; }
 private:
@@ -20,7 +47,9 @@ private:
     };
 private:
     void keyEncountered() { m_keyEncountered = true; }
+    bool isKeyReplaceScope() const;
     std::string printDebug(size_t const& _i);
+    void init();
     bool isEmptyChar(char const& _char) const;
     RET tryParseKeyValue(size_t& _i);
     RET tryParseArrayBegin(size_t const& _i);
@@ -29,13 +58,13 @@ private:
 
 private:
     // Work with iterator i
-    bool checkExcessiveComaBefore(size_t const& _i) const;
-    size_t skipSpaces(size_t const& _i) const;
-    std::string parseKeyValue(size_t& _i) const;
-    bool readBoolOrNull(size_t& _i, bool& _result, bool& _readNull) const;
-    bool readDigit(size_t& _i, int& _result) const;
+    bool checkExcessiveComaBefore(size_t const& _i);
+    size_t skipSpaces(size_t const& _i);
+    std::string parseKeyValue(size_t& _i);
+    bool readBoolOrNull(size_t& _i, bool& _result, bool& _readNull);
+    bool readDigit(size_t& _i, int& _result);
 private:
-    std::string const& m_input;
+    JsonInput m_input;
     CJOptions const m_opt;
 
     std::vector<DataObject*> m_applyDepth;  // indexes at root array of objects that we are reading into
@@ -152,10 +152,20 @@ void writeFile(boost::filesystem::path const& _file, bytesConstRef _data, bool _
 {
 	if (_writeDeleteRename)
 	{
-		fs::path tempPath = appendToFilename(_file, "-%%%%%%"); // XXX should not convert to string for this
-		writeFile(tempPath, _data, false);
-		// will delete _file if it exists
-		fs::rename(tempPath, _file);
+		// Unique temp file in the same folder, so that concurrent writers never share it
+		fs::path const tempPath = _file.parent_path() / fs::unique_path(_file.filename().string() + "-%%%%-%%%%-%%%%");
+		try
+		{
+			writeFile(tempPath, _data, false);
+			// will delete _file if it exists
+			fs::rename(tempPath, _file);
+		}
+		catch (...)
+		{
+			boost::system::error_code ec;
+			fs::remove(tempPath, ec);
+			throw;
+		}
 	}
     else
         writeFileInternal(_file, _data);
@@ -1,13 +1,13 @@
 #include <retesteth/EthChecks.h>
 #include <retesteth/ExitHandler.h>
 #include <retesteth/Options.h>
+#include <retesteth/helpers/LogSink.h>
 #include <retesteth/helpers/TestOutputHelper.h>
 #include <boost/algorithm/string.hpp>
 #include <csignal>
 #include <mutex>
 using namespace std;
 
-mutex g_debugFlagAccess;
 namespace test::debug
 {
 
@@ -32,43 +32,37 @@ Debug const& Debug::get()
 
 Debug::Debug()
 {
-    for (int channel = DC::RPC; channel != DC::LOWLOG; channel++)
-    {
-        DC channelType = static_cast<DC>(channel);
-        m_channels[channelType] = false;
-    }
-    m_channels[DC::LOWLOG] = false;
     if (!Options::get().logVerbosity.str.empty())
     {
         std::vector<string> elements;
         boost::split(elements, Options::get().logVerbosity.str, boost::is_any_of("|"));
         for (auto const& flag : elements)
         {
-            m_channels[DC::DEFAULT] = true;
+            set(DC::DEFAULT);
             if (flag == "RPC")
             {
-                m_channels[DC::RPC] = true;
-                m_channels[DC::WARNING] = true;
+                set(DC::RPC);
+                set(DC::WARNING);
             }
             else if (flag == "RPC2")
             {
-                m_channels[DC::RPC2] = true;
-                m_channels[DC::WARNING] = true;
+                set(DC::RPC2);
+                set(DC::WARNING);
             }
             else if (flag == "STATS")
-                m_channels[DC::STATS] = true;  // Default test execution stats
+                set(DC::STATS);  // Default test execution stats
             else if (flag == "STATS2")
-                m_channels[DC::STATS2] = true;
+                set(DC::STATS2);
             else if (flag == "STATE")
-                m_channels[DC::STATE] = true;  // Poststate output
+                set(DC::STATE);  // Poststate output
             else if (flag == "SOCKET")
-                m_channels[DC::SOCKET] = true;  // Socket debug information
+                set(DC::SOCKET);  // Socket debug information
             else if (flag == "TESTLOG")
-                m_channels[DC::TESTLOG] = true;  // Additional test execution info
+                set(DC::TESTLOG);  // Additional test execution info
             else if (flag == "LOWLOG")
-                m_channels[DC::LOWLOG] = true;  // Peculiar debug info
+                set(DC::LOWLOG);  // Peculiar debug info
             else if (flag == "WARNING")
-                m_channels[DC::WARNING] = true;  // Warning messages
+                set(DC::WARNING);  // Warning messages
             else
                 ETH_STDOUT_MESSAGEC("WARNING: Debug channel `" + flag + "` not found!", cYellow);
         }
@@ -77,38 +71,32 @@ Debug::Debug()
         initializeDefaultChannels();
 };
 
-bool Debug::flag(DC _channel) const
-{
-    std::lock_guard<std::mutex> lock(g_debugFlagAccess);
-    return m_channels.at(_channel);
-}
-
 void Debug::initializeDefaultChannels()
 {
     // Default log channel initialization
     auto const& verb = Options::get().logVerbosity.val;
-    m_channels[DC::DEFAULT] = true;
+    set(DC::DEFAULT);
     if (verb >= 1)
     {
-        m_channels[DC::STATS] = true;
-        m_channels[DC::WARNING] = true;
+        set(DC::STATS);
+        set(DC::WARNING);
     }
     if (verb >= 2)
-        m_channels[DC::STATS2] = true;
+        set(DC::STATS2);
     if (verb >= 3)
-        m_channels[DC::TESTLOG] = true; 
+        set(DC::TESTLOG); 
     if (verb >= 5)
-        m_channels[DC::STATE] = true;
+        set(DC::STATE);
     if (verb >= 6)
-        m_channels[DC::RPC] = true;
+        set(DC::RPC);
     if (verb >= 7)
     {
-        m_channels[DC::SOCKET] = true;
-        m_channels[DC::LOWLOG] = true;
-        m_channels[DC::RPC2] = true;
+        set(DC::SOCKET);
+        set(DC::LOWLOG);
+        set(DC::RPC2);
     }
     if (Options::get().poststate.initialized() || Options::get().statediff.initialized())
-        m_channels[DC::STATE] = true;
+        set(DC::STATE);
 }
 
 
@@ -136,6 +124,7 @@ void eth_warning_message(std::string const& _message)
 
 void eth_stdout_message(std::string const& _message, std::string const& _color)
 {
+    LogSink::get().flush();
     if (_color.empty() || Options::get().nologcolor)
         std::cout <<  _message << std::endl;
     else
@@ -144,6 +133,7 @@ void eth_stdout_message(std::string const& _message, std::string const& _color)
 
 void eth_stderror_message(std::string const& _message)
 {
+    LogSink::get().flush();
     if (Options::get().nologcolor)
         std::cerr << _message << std::endl;
     else
@@ -164,10 +154,16 @@ inline string const& LogColorToColor(LogColor _color)
 
 void eth_log_message(std::string const& _message, LogColor _color)
 {
-    if (Options::get().nologcolor || _color == LogColor::DEFAULT)
-        std::cout << _message << std::endl;
+    // Channel logs are written asynchronously so worker threads do not wait on stdout
+    bool const colored = !Options::get().nologcolor && _color != LogColor::DEFAULT;
+    string line;
+    line.reserve(_message.size() + 16);
+    if (colored)
+        line.append(LogColorToColor(_color)).append(_message).append(cDefault);
     else
-        std::cout << LogColorToColor(_color) << _message << cDefault << std::endl;
+        line.append(_message);
+    line.push_back('\n');
+    LogSink::get().write(std::move(line));
 }
 
 void eth_error(std::string const& _message)
@@ -1,4 +1,5 @@
 #pragma once
+#include <cstdint>
 #include <map>
 #include <string>
 
@@ -18,17 +19,19 @@ enum DC
     LOWLOG
 };
 
+// Enabled log channels. Initialized once from options and read without locking
 class Debug
 {
 public:
     static Debug const& get();
-    bool flag(DC _channel) const;
+    bool flag(DC _channel) const { return m_channels & (1u << _channel); }
 
 private:
     Debug();
     Debug(Debug const&) = delete;
     void initializeDefaultChannels();
-    std::map<DC, bool> m_channels;
+    void set(DC _channel) { m_channels |= (1u << _channel); }
+    uint32_t m_channels = 0;
 };
 
 enum class LogColor
@@ -97,6 +97,10 @@ Options::Options(int argc, const char** argv)
         },[this](){
             threadCount = max((size_t)1, (size_t)threadCount);
     });
+    ADD_OPTION(globalQueue, "--globalqueue", [](){
+        cout << setw(40) << "--globalqueue" << setw(0) << "Run fillers of all selected folders from one queue, longest first\n";
+        cout << setw(40) << " " << setw(0) << "|-Threads do not wait for a folder to finish before the next one\n";
+    });
     ADD_OPTION(clients, "--clients", [](){
         cout << setw(40) << "--clients `client1, client2`" << setw(0)
              << "Use following configurations from datadir path (default: ~/.retesteth)\n";
@@ -108,6 +112,52 @@ Options::Options(int argc, const char** argv)
         cout << setw(40) << "--nodes" << setw(0) << "List of client tcp ports (\"addr:ip, addr:ip\")\n";
         cout << setw(40) << " " << setw(0) << "|-Overrides the config file \"socketAddress\" section \n";
     });
+    ADD_OPTION(warmClients, "--warmclients", [](){
+        cout << setw(40) << "--warmclients <K>" << setw(0) << "Keep K pre-started ipc client instances to swap in on restart\n";
+    });
+    ADD_OPTIONV(recycleAfter, "--recycleafter", [](){
+        cout << setw(40) << "--recycleafter <N>" << setw(0) << "Restart client instances after N test runs (default: 1500)\n";
+        },[this](){
+            if (recycleAfter == 0)
+                BOOST_THROW_EXCEPTION(InvalidOption("Error: --recycleafter must be greater than 0"));
+    });
+    ADD_OPTION(compileCache, "--compilecache", [](){
+        cout << setw(40) << "--compilecache <dir>" << setw(0) << "Cache compiled code in a folder\n";
+        cout << setw(40) << " " << setw(0) << "|-Custom compilers are cached by the script content, not the tools it calls \n";
+    });
+    ADD_OPTIONV(compileCacheSize, "--compilecachesize", [](){
+        cout << setw(40) << "--compilecachesize <MB>" << setw(0) << "Compile cache size limit (default: 256)\n";
+        },[this](){
+            if (compileCacheSize == 0)
+                BOOST_THROW_EXCEPTION(InvalidOption("Error: --compilecachesize must be greater than 0"));
+    });
+    ADD_OPTION(testCache, "--testcache", [](){
+        cout << setw(40) << "--testcache <dir>" << setw(0) << "Cache parsed json tests in binary form in a folder\n";
+    });
+    ADD_OPTIONV(testCacheSize, "--testcachesize", [](){
+        cout << setw(40) << "--testcachesize <MB>" << setw(0) << "Test cache size limit (default: 1024)\n";
+        },[this](){
+            if (testCacheSize == 0)
+                BOOST_THROW_EXCEPTION(InvalidOption("Error: --testcachesize must be greater than 0"));
+    });
+    ADD_OPTION(testHistory, "--testhistory", [](){
+        cout << setw(40) << "--testhistory <file>" << setw(0) << "Test times of previous runs to start the longest tests first\n";
+        cout << setw(40) << " " << setw(0) << "|-(default: datadir/testhistory.json)\n";
+    });
+    ADD_OPTION(shard, "--shard", [](){
+        cout << setw(40) << "--shard <i/N>" << setw(0) << "Run only the i-th of N deterministic parts of the test fillers\n";
+    });
+    ADD_OPTION(shardWeights, "--shardweights", [](){
+        cout << setw(40) << "--shardweights <file>" << setw(0) << "Balance `--shard` by test durations from a previous report or a --testhistory file\n";
+        cout << setw(40) << " " << setw(0) << "|-Every shard must use the same file\n";
+    });
+    ADD_OPTION(testReport, "--report", [](){
+        cout << setw(40) << "--report <file>" << setw(0) << "Write machine readable test results to a file\n";
+        cout << setw(40) << " " << setw(0) << "|-With `--shard` defaults to retesteth-shard-<i>-of-<N>.json\n";
+    });
+    ADD_OPTION(mergeReports, "--merge-reports", [](){
+        cout << setw(40) << "--merge-reports <files>" << setw(0) << "Print the summary of shard reports (\"file, folder\") and exit\n";
+    });
     ADD_OPTION(testpath, "--testpath", [](){
         cout << "\nSetting test suite and test\n";
         cout << setw(40) << "--testpath <PathToTheTestRepo>" << setw(25) << "Set path to the test repo\n";
@@ -233,12 +283,21 @@ Options::Options(int argc, const char** argv)
     ADD_OPTION(exectimelog, "--exectimelog", [](){
         cout << setw(30) << "--exectimelog" << setw(25) << "Output execution time for each test suite\n";
     });
+    ADD_OPTION(traceFile, "--tracefile", [](){
+        cout << setw(30) << "--tracefile <file>" << setw(25) << "Write time of test execution phases in chrome://tracing json format\n";
+    });
     ADD_OPTION(enableClientsOutput, "--stderr", [](){
         cout << setw(30) << "--stderr" << setw(25) << "Redirect ipc client stderr to stdout\n";
     });
     ADD_OPTION(travisOutThread, "--travisout", [](){
         cout << setw(30) << "--travisout" << setw(25) << "Output `.` to stdout\n";
     });
+    ADD_OPTION(eofcrosscheck, "--eofcrosscheck", [](){
+        cout << setw(30) << "--eofcrosscheck" << setw(25) << "Validate all EOF codes with the client and compare with retesteth EOF header check\n";
+    });
+    ADD_OPTION(eofnativecheck, "--eofnativecheck", [](){
+        cout << setw(30) << "--eofnativecheck" << setw(25) << "Run EOF tests with retesteth EOF header check, codes it rejects are not sent to the client\n";
+    });
     ADD_OPTION(all, "--all", [](){
         cout << "\nAdditional Tests\n";
         cout << setw(30) << "--all" << setw(0) << "Enable all tests\n";
@@ -274,6 +333,12 @@ Options::Options(int argc, const char** argv)
                 std::cout << "WARNING: `--fillchain` option provided without `--filltests`, activating `--filltests` (did you mean `--filltests`?)\n";
                 filltests = true;
         }});
+    ADD_OPTIONV(fillcompressed, "--fillcompressed", [](){
+        cout << setw(30) << "--fillcompressed <gz|zst>" << setw(25) << "Write filled tests compressed (.json.gz, .json.zst)\n";
+        },[this](){
+            if (fillcompressed != "gz" && fillcompressed != "zst")
+                BOOST_THROW_EXCEPTION(InvalidOption("Error: --fillcompressed expects `gz` or `zst`, got: " + fillcompressed));
+    });
     ADD_OPTION(chainid, "--chainid", [](){
         cout << setw(30) << "--chainid" << setw(25) << "Override config chainid when generating transactions\n";
     });
@@ -319,7 +384,8 @@ Options::Options(int argc, const char** argv)
     for(auto const& el : argList)
         BOOST_THROW_EXCEPTION(InvalidOption("Error: Dublicate or unrecognized option: `" + string(el) + "`"));
 
-    if (threadCount == 1)
+    // Warm client spares are started in background threads
+    if (threadCount == 1 && warmClients == 0)
         dataobject::GCP_SPointer<int>::DISABLETHREADSAFE();
 }
 
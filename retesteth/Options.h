@@ -190,6 +190,16 @@ private:
         void initArg(std::string const& _arg) override;
     };
 
+    struct shard_opt : public Option
+    {
+        shard_opt() { m_argType = ARGS::ONE;}
+        size_t index = 0;  // from 1
+        size_t count = 1;
+        std::string str() const { return std::to_string(index) + "/" + std::to_string(count); }
+
+    protected:
+        void initArg(std::string const& _arg) override;
+    };
 
 public:
     // General Options
@@ -202,9 +212,21 @@ public:
 
     // Retesteth options
     sizet_opt threadCount = 1;
+    bool_opt globalQueue = false;
     vecstr_opt clients;
     string_opt datadir;
     vecaddr_opt nodesoverride;
+    sizet_opt warmClients = 0;
+    sizet_opt recycleAfter = 1500;
+    string_opt compileCache;
+    sizet_opt compileCacheSize = 256;
+    string_opt testCache;
+    sizet_opt testCacheSize = 1024;
+    string_opt testHistory;
+    shard_opt shard;
+    string_opt shardWeights;
+    string_opt testReport;
+    vecstr_opt mergeReports;
 
     // Setting test suite and test
     fspath_opt testpath;
@@ -230,8 +252,11 @@ public:
     stringosizet_opt logVerbosity = 1;
     bool_opt nologcolor = false;
     bool_opt exectimelog = false;
+    string_opt traceFile;
     bool_opt enableClientsOutput = false;
     bool_opt travisOutThread = false;
+    bool_opt eofcrosscheck = false;
+    bool_opt eofnativecheck = false;
     string_opt t8ntoolcall;
 
     // Additional Tests
@@ -243,6 +268,7 @@ public:
     bool_opt filloutdated = false;
     bool_opt fillvmtrace = false;
     bool_opt fillchain = false;
+    string_opt fillcompressed;
     sizet_opt chainid = 1;
     bool_opt showhash = false;
     bool_opt checkhash = false;
@@ -1,5 +1,6 @@
 #include "Options.h"
 #include <retesteth/helpers/TestHelper.h>
+#include <retesteth/helpers/TestInfo.h>
 #include <boost/algorithm/string.hpp>
 #include <boost/test/unit_test.hpp>
 
@@ -19,11 +20,11 @@ string Options::getGStateTransactionFilter() const
 
 bool Options::isLegacy()
 {
-    static bool isLegacy = (boost::unit_test::framework::current_test_case().full_name().find("LegacyTests") != string::npos);
+    static bool isLegacy = (TestInfo::caseFullName().find("LegacyTests") != string::npos);
 
     // Current test case is dynamic if we run all tests. need to see if we hit LegacyTests
     if (Options::get().rCurrentTestSuite.empty())
-        isLegacy = (boost::unit_test::framework::current_test_case().full_name().find("LegacyTests") != string::npos);
+        isLegacy = (TestInfo::caseFullName().find("LegacyTests") != string::npos);
 
     return isLegacy;
 }
@@ -262,6 +263,18 @@ void Options::fspath_opt::initArg(std::string const& _arg)
         BOOST_THROW_EXCEPTION(InvalidOption("Error: `" + m_sOptionName + "` could not locate file or path: " + _arg));
 }
 
+void Options::shard_opt::initArg(std::string const& _arg)
+{
+    size_t const pos = _arg.find('/');
+    if (pos == std::string::npos || test::stringIntegerType(_arg.substr(0, pos)) != DigitsType::Decimal ||
+        test::stringIntegerType(_arg.substr(pos + 1)) != DigitsType::Decimal)
+        BOOST_THROW_EXCEPTION(InvalidOption("Error: `" + m_sOptionName + "` expects i/N argument, got: " + _arg));
+    index = std::max(0, atoi(_arg.substr(0, pos).c_str()));
+    count = std::max(0, atoi(_arg.substr(pos + 1).c_str()));
+    if (count == 0 || index == 0 || index > count)
+        BOOST_THROW_EXCEPTION(InvalidOption("Error: `" + m_sOptionName + "` index must be from 1 to N, got: " + _arg));
+}
+
 void Options::statediff_opt::initArg(std::string const& _arg)
 {
     string const del = "to";
@@ -0,0 +1,78 @@
+#include "CompileCache.h"
+#include <libdevcore/CommonIO.h>
+#include <libdevcore/SHA3.h>
+#include <retesteth/EthChecks.h>
+#include <retesteth/Options.h>
+#include <boost/filesystem.hpp>
+
+using namespace std;
+using namespace dev;
+using namespace test;
+using namespace test::debug;
+namespace fs = boost::filesystem;
+
+namespace test::compiler
+{
+CompileCache::CompileCache(fs::path const& _dir, size_t _maxBytes) : m_folder(_dir, _maxBytes, "Compile cache") {}
+
+CompileCache& CompileCache::get()
+{
+    // Opt-in, tools called by custom compiler scripts are not a part of the cache key
+    static CompileCache cache = []() {
+        Options const& opt = Options::get();
+        return CompileCache(fs::path(opt.compileCache), opt.compileCacheSize * 1024 * 1024);
+    }();
+    return cache;
+}
+
+string CompileCache::key(string const& _compiler, string const& _source)
+{
+    return dev::sha3(_compiler + '\0' + _source).hex();
+}
+
+string CompileCache::compile(string const& _compiler, string const& _source, std::function<string()> const& _compile)
+{
+    if (!m_folder.enabled())
+        return _compile();
+
+    string const entryKey = key(_compiler, _source);
+    string output;
+    if (find(entryKey, output))
+    {
+        ETH_DC_MESSAGE(DC::LOWLOG, "Compile cache hit: " + entryKey);
+        return output;
+    }
+
+    output = _compile();
+    insert(entryKey, output);
+    return output;
+}
+
+bool CompileCache::find(string const& _key, string& _output) const
+{
+    fs::path const path = m_folder.entryPath(_key);
+    boost::system::error_code ec;
+    if (!fs::exists(path, ec))
+        return false;
+    _output = dev::contentsString(path);
+    if (_output.empty())
+        return false;
+    m_folder.markUsed(_key);
+    return true;
+}
+
+void CompileCache::insert(string const& _key, string const& _output)
+{
+    if (_output.empty())
+        return;
+    try
+    {
+        m_folder.write(_key, _output);
+    }
+    catch (std::exception const& _ex)
+    {
+        ETH_WARNING(string("Could not write compile cache entry: ") + _ex.what());
+    }
+}
+
+}  // namespace test::compiler
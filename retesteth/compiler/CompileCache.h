@@ -0,0 +1,32 @@
+#pragma once
+#include <retesteth/helpers/CacheFolder.h>
+#include <boost/filesystem/path.hpp>
+#include <functional>
+#include <string>
+
+namespace test::compiler
+{
+// Content addressed on disk cache of compiler outputs
+// Entries are keyed by hash(compiler identity + source) and written with atomic rename,
+// so the folder could be shared by worker threads and parallel retesteth runs
+// Folder size is bound by removing the least recently used entries
+class CompileCache
+{
+public:
+    // Empty _dir disables the cache
+    CompileCache(boost::filesystem::path const& _dir, size_t _maxBytes);
+    static CompileCache& get();
+
+    // Return cached output of _compile for _source or run it and cache the result
+    std::string compile(std::string const& _compiler, std::string const& _source, std::function<std::string()> const& _compile);
+
+    static std::string key(std::string const& _compiler, std::string const& _source);
+    bool find(std::string const& _key, std::string& _output) const;
+    void insert(std::string const& _key, std::string const& _output);
+    void evict() { m_folder.evict(); }
+
+private:
+    CacheFolder m_folder;
+};
+
+}  // namespace test::compiler
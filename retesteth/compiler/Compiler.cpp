@@ -1,8 +1,17 @@
+#include "CompileCache.h"
 #include "Options.h"
+#include <retesteth/helpers/Process.h>
 #include <retesteth/helpers/TestHelper.h>
 #include <libdevcore/CommonIO.h>
+#include <libdevcore/SHA3.h>
 #include <retesteth/EthChecks.h>
 #include <retesteth/helpers/TestOutputHelper.h>
+#include <retesteth/helpers/TraceSpan.h>
+#include <retesteth/session/ThreadManager.h>
+#include <boost/algorithm/string/trim.hpp>
+#include <condition_variable>
+#include <mutex>
+#include <set>
 using namespace dev;
 using namespace test;
 using namespace std;
@@ -39,27 +48,114 @@ void removeCommentsFromCode(string& _code)
     }
 }
 
+// Source compiled by running an external compiler program
+struct ExternalSource
+{
+    string compiler;  // identity of the compiler and its version
+    fs::path program;
+    string source;
+};
+
+// Compiled outputs of PrecompiledCode object of this thread
+thread_local std::map<string, string> const* t_precompiled = nullptr;
+
+// Path in the temp folder that is removed when leaving the scope
+class TempPath
+{
+public:
+    TempPath() : m_path(fs::temp_directory_path() / fs::unique_path()) {}
+    ~TempPath()
+    {
+        boost::system::error_code ec;
+        fs::remove_all(m_path, ec);
+    }
+    fs::path const& path() const { return m_path; }
+
+private:
+    fs::path m_path;
+};
+
+// Compiler processes of all threads are bounded by -j
+// Each test thread could start a pool of precompile workers, so a per call limit is not enough
+class CompileSlot
+{
+public:
+    CompileSlot()
+    {
+        size_t const limit = std::max<size_t>(Options::get().threadCount, 1);
+        std::unique_lock<std::mutex> lock(s_mutex);
+        s_released.wait(lock, [limit]() { return s_used < limit; });
+        s_used++;
+    }
+    ~CompileSlot()
+    {
+        {
+            std::lock_guard<std::mutex> lock(s_mutex);
+            s_used--;
+        }
+        s_released.notify_one();
+    }
+    CompileSlot(CompileSlot const&) = delete;
+    CompileSlot& operator=(CompileSlot const&) = delete;
+
+private:
+    static std::mutex s_mutex;
+    static std::condition_variable s_released;
+    static size_t s_used;
+};
+std::mutex CompileSlot::s_mutex;
+std::condition_variable CompileSlot::s_released;
+size_t CompileSlot::s_used = 0;
+
+// Run the compiler program on the source written to a temp file
+// _reportErrors marks a failed compilation as an error of the current test, otherwise it only throws
+string compileExternal(ExternalSource const& _src, bool _reportErrors)
+{
+    TempPath const sourceFile;
+    writeFile(sourceFile.path().string(), _src.source);
+    vector<string> const argv = {_src.program.string(), sourceFile.path().string()};
+    CompileSlot const slot;
+    if (_reportErrors)
+    {
+        int exitCode;
+        return executeProcess(argv, exitCode);
+    }
+    ProcessResult const res = runProcess(argv);
+    if (res.exitCode != 0)
+        throw std::runtime_error("compiler exited with " + to_string(res.exitCode));
+    return boost::trim_copy(res.out);
+}
+
+string runExternalCompiler(ExternalSource const& _src)
+{
+    if (t_precompiled != nullptr)
+    {
+        auto const it = t_precompiled->find(CompileCache::key(_src.compiler, _src.source));
+        if (it != t_precompiled->end())
+            return it->second;
+    }
+    return CompileCache::get().compile(_src.compiler, _src.source, [&_src]() { return compileExternal(_src, true); });
+}
+
+ExternalSource lllSource(string const& _code)
+{
+    return {"lllc " + prepareLLLCVersionString(), "lllc", _code};
+}
+
 string compileLLL(string const& _code)
 {
 #if defined(_WIN32)
     BOOST_ERROR("LLL compilation only supported on posix systems.");
     return "";
 #else
-    fs::path path(fs::temp_directory_path() / fs::unique_path());
-    string cmd = string("lllc ") + path.string();
-    writeFile(path.string(), _code);
     try
     {
-        int exitCode;
-        string result = executeCmd(cmd, exitCode);
-        fs::remove_all(path);
-        result = "0x" + result;
+        string result = "0x" + runExternalCompiler(lllSource(_code));
         test::compiler::utiles::checkHexHasEvenLength(result);
         return result;
     }
     catch (EthError const& _ex)
     {
-        fs::remove_all(path);
         ETH_WARNING("Error compiling lll code: " + _code.substr(0, 50) + "..");
         throw _ex;
     }
@@ -67,7 +163,21 @@ string compileLLL(string const& _code)
 }
 
 
-bool tryCustomCompiler(string const& _code, string& _compiledCode)
+// Custom compiler script is identified by its content
+string customCompilerIdentity(fs::path const& _compiler)
+{
+    static std::mutex identityMutex;
+    static std::map<fs::path, string> identities;
+    std::lock_guard<std::mutex> lock(identityMutex);
+    auto const it = identities.find(_compiler);
+    if (it != identities.end())
+        return it->second;
+    string const identity = "custom " + _compiler.string() + " " + dev::sha3(dev::contentsString(_compiler)).hex();
+    identities.emplace(_compiler, identity);
+    return identity;
+}
+
+bool findCustomCompiler(string const& _code, ExternalSource& _src)
 {
     auto const& compilers = Options::getCurrentConfig().cfgFile().customCompilers();
     for (auto const& compiler : compilers)
@@ -78,14 +188,7 @@ bool tryCustomCompiler(string const& _code, string& _compiledCode)
             char afterPrefix = _code[pos + compiler.first.length()];
             if ((afterPrefix == ' ' || afterPrefix == '\n'))
             {
-                string const customCode = _code.substr(pos + compiler.first.length() + 1);
-                fs::path path(fs::temp_directory_path() / fs::unique_path());
-                string cmd = compiler.second.string() + " " + path.string();
-                writeFile(path.string(), customCode);
-
-                int exitCode;
-                _compiledCode = test::executeCmd(cmd, exitCode);
-                utiles::checkHexHasEvenLength(_compiledCode);
+                _src = {customCompilerIdentity(compiler.second), compiler.second, _code.substr(pos + compiler.first.length() + 1)};
                 return true;
             }
         }
@@ -93,6 +196,29 @@ bool tryCustomCompiler(string const& _code, string& _compiledCode)
     return false;
 }
 
+bool tryCustomCompiler(string const& _code, string& _compiledCode)
+{
+    ExternalSource src;
+    if (!findCustomCompiler(_code, src))
+        return false;
+    _compiledCode = runExternalCompiler(src);
+    utiles::checkHexHasEvenLength(_compiledCode);
+    return true;
+}
+
+// Rough check for the code that tryKnownCompilers pass to lllc
+bool isLLLSource(string const& _code)
+{
+    // Sources with a compiler prefix like :yul are never passed to lllc
+    size_t const start = _code.find_first_not_of(" \t\n");
+    if (start == string::npos || _code.at(start) == ':')
+        return false;
+    if (_code.find("pragma solidity") != string::npos || _code.find(":solidity") != string::npos ||
+        _code.find(":raw") != string::npos || _code.find(":abi") != string::npos)
+        return false;
+    return _code.find('{') != string::npos || _code.find("(asm") != string::npos;
+}
+
 void tryKnownCompilers(string const& _code, solContracts const& _preSolidity, string& _compiledCode)
 {
     string const c_rawPrefix = ":raw";
@@ -178,6 +304,7 @@ void checkHexHasEvenLength(string const& _hex)
 /// And transaction "data" filed in Fillers
 string replaceCode(string const& _code, solContracts const& _preSolidity)
 {
+    ETH_TRACE_SPAN("replaceCode");
     if (_code == "")
         return "0x";
 
@@ -200,4 +327,54 @@ string replaceCode(string const& _code, solContracts const& _preSolidity)
             compiledCode.size() > 0, "Bytecode is missing! '" + _code + "' " + TestOutputHelper::get().testName());
     return compiledCode;
 }
+
+PrecompiledCode::PrecompiledCode(std::vector<std::string> const& _codes) : m_previous(t_precompiled)
+{
+#if !defined(_WIN32)
+    std::vector<ExternalSource> sources;
+    std::set<string> keys;
+    for (auto const& code : _codes)
+    {
+        if (code.empty() || code.substr(0, 2) == "0x")
+            continue;
+        ExternalSource src;
+        if (!findCustomCompiler(code, src))
+        {
+            if (!isLLLSource(code))
+                continue;
+            src = lllSource(code);
+        }
+        if (keys.emplace(CompileCache::key(src.compiler, src.source)).second)
+            sources.emplace_back(std::move(src));
+    }
+    if (sources.size() < 2)
+        return;
+
+    // Workers do not report errors, failed sources are compiled again by replaceCode
+    // Compiler processes of the workers of all tests are bounded by -j in compileExternal
+    std::vector<string> outputs(sources.size());
+    session::ThreadManager::runParallel(sources.size(), [&sources, &outputs](size_t _i) {
+        ExternalSource const& src = sources.at(_i);
+        try
+        {
+            outputs.at(_i) = CompileCache::get().compile(src.compiler, src.source, [&src]() { return compileExternal(src, false); });
+        }
+        catch (std::exception const&)
+        {
+            outputs.at(_i).clear();
+        }
+    });
+
+    for (size_t i = 0; i < sources.size(); i++)
+        if (!outputs.at(i).empty())
+            m_compiled.emplace(CompileCache::key(sources.at(i).compiler, sources.at(i).source), std::move(outputs.at(i)));
+    ETH_DC_MESSAGE(test::debug::DC::LOWLOG, "Precompiled " + to_string(m_compiled.size()) + " of " + to_string(sources.size()) + " sources");
+#endif
+    t_precompiled = &m_compiled;
+}
+
+PrecompiledCode::~PrecompiledCode()
+{
+    t_precompiled = m_previous;
+}
 }  // namespace compiler
@@ -1,6 +1,8 @@
 #pragma once
 #include <libdataobj/DataObject.h>
+#include <map>
 #include <string>
+#include <vector>
 
 namespace test::compiler
 {
@@ -37,6 +39,23 @@ solContracts compileSolidity(std::string const& _code);
 /// compile LLL / wasm or other src code into bytecode
 std::string replaceCode(std::string const& _code, solContracts const& _preSolidity = solContracts());
 
+/// compile lllc and custom compiler sources of a test on a pool of threads
+/// while the object exists replaceCode in this thread takes the compiled code from it
+/// sources that fail to compile are left for replaceCode to report
+class PrecompiledCode
+{
+public:
+    PrecompiledCode(std::vector<std::string> const& _codes);
+    ~PrecompiledCode();
+    PrecompiledCode(PrecompiledCode const&) = delete;
+    PrecompiledCode& operator=(PrecompiledCode const&) = delete;
+    std::map<std::string, std::string> const& compiled() const { return m_compiled; }
+
+private:
+    std::map<std::string, std::string> m_compiled;
+    std::map<std::string, std::string> const* m_previous;
+};
+
 /// compile clean YUL
 std::string compileYul(std::string const& _code);
 
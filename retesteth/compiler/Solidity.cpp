@@ -1,3 +1,4 @@
+#include "CompileCache.h"
 #include <retesteth/helpers/TestHelper.h>
 #include <libdevcore/CommonIO.h>
 #include <libdevcore/SHA3.h>
@@ -433,10 +434,11 @@ solContracts compileSolidity(string const& _code)
     return "";
 #else
     fs::path const path(fs::temp_directory_path() / fs::unique_path());
-    string const cmd = string("solc --bin-runtime ") + path.string();
-    writeFile(path.string(), _code);
-    int exitCode;
-    string result = executeCmd(cmd, exitCode);
+    string result = CompileCache::get().compile("solc --bin-runtime " + prepareSolidityVersionString(), _code, [&path, &_code]() {
+        writeFile(path.string(), _code);
+        int exitCode;
+        return executeProcess({"solc", "--bin-runtime", path.string()}, exitCode);
+    });
 
     solContracts contracts;
     string const codeNamePrefix = "=======";
@@ -52,6 +52,10 @@ ClientConfig::ClientConfig(fs::path const& _clientConfigPath) : m_id(ClientConfi
         // Load client config file
         m_clientConfigFile = GCP_SPointer<ClientConfigFile>(new ClientConfigFile(configFile));
 
+        // Compile field replace rules into lookup tables for both directions
+        m_fieldReplaceToClient = compileFieldReplace(cfgFile().fieldreplace(), FieldReplaceDir::RetestethToClient);
+        m_fieldReplaceToRetesteth = compileFieldReplace(cfgFile().fieldreplace(), FieldReplaceDir::ClientToRetesteth);
+
         // Load genesis templates from default dir if not set in this folder
         fs::path genesisTemplatePath = _clientConfigPath / "genesis";
         fs::path default_genesisTemplatePath = default_ClientConfigPath / "genesis";
@@ -331,33 +335,34 @@ void ClientConfig::initializeFirstSetup()
     }
 }
 
-void ClientConfig::performFieldReplace(DataObject& _data, FieldReplaceDir const& _dir) const
+KeyReplaceMap ClientConfig::compileFieldReplace(std::map<string, string> const& _rules, FieldReplaceDir const& _dir)
 {
-    if (cfgFile().fieldreplace().size() == 0)
-        return;
-
-    for (auto const& el : cfgFile().fieldreplace())
+    // Rules are applied one after another, a key renamed by a rule could be renamed again by the next rules
+    KeyReplaceMap map;
+    for (auto const& rule : _rules)
     {
-        std::string const& retestethNotice = el.first;
-        std::string const& clientNotice = el.second;
-
-        if (_dir == FieldReplaceDir::RetestethToClient)
-        {
-            if (!_data.getKey().empty() && _data.getKey() == retestethNotice)
-                _data.setKey(clientNotice);
-        }
-        else
+        string const& key = (_dir == FieldReplaceDir::RetestethToClient) ? rule.first : rule.second;
+        if (map.count(key))
+            continue;
+        string replaced = key;
+        for (auto const& el : _rules)
         {
-            if (!_data.getKey().empty() && _data.getKey() == clientNotice)
-                _data.setKey(retestethNotice);
+            string const& from = (_dir == FieldReplaceDir::RetestethToClient) ? el.first : el.second;
+            if (replaced == from)
+                replaced = (_dir == FieldReplaceDir::RetestethToClient) ? el.second : el.first;
         }
+        map.emplace(key, replaced);
     }
+    return map;
+}
 
-    if (_data.type() == DataType::Object || _data.type() == DataType::Array)
-    {
-        for (auto& obj : _data.getSubObjectsUnsafe())
-            performFieldReplace(obj.getContent(), _dir);
-    }
+KeyReplaceMap const* ClientConfig::fieldReplaceMap(FieldReplaceDir const& _dir) const
+{
+    KeyReplaceMap const& map =
+        (_dir == FieldReplaceDir::RetestethToClient) ? m_fieldReplaceToClient : m_fieldReplaceToRetesteth;
+    if (map.empty())
+        return nullptr;
+    return &map;
 }
 
 spVALUE const& ClientConfig::getRewardForFork(FORK const& _fork) const
@@ -82,8 +82,11 @@ public:
     boost::filesystem::path const& getStopperScript() const { return m_stopperScriptPath; }
     boost::filesystem::path const& getPySpecsStartScript() const { return m_pyspecsStartPath; }
 
-    // Replace notations in requests if needed
-    void performFieldReplace(DataObject& _data, FieldReplaceDir const& _dir) const;
+    // Key replace notations of requests for the json parser/writer, nullptr if none
+    KeyReplaceMap const* fieldReplaceMap(FieldReplaceDir const& _dir) const;
+
+    // Final name of each key after all fieldReplace rules in _dir
+    static KeyReplaceMap compileFieldReplace(std::map<std::string, std::string> const& _rules, FieldReplaceDir const& _dir);
 
 private:
     ClientConfigID m_id;                                ///< Internal id
@@ -91,6 +94,8 @@ private:
     std::map<FORK, spVALUE> m_correctReward;            ///< Correct mining reward info for StateTests->BlockchainTests
     std::map<FORK, spDataObject> m_genesisTemplate;     ///< Template For test_setChainParams
     std::map<FORK, spVALUE> m_genesisTemplateChainID;   ///< ChainID value from template read
+    KeyReplaceMap m_fieldReplaceToClient;               ///< fieldReplace rules retesteth => client
+    KeyReplaceMap m_fieldReplaceToRetesteth;            ///< fieldReplace rules client => retesteth
 
 
     boost::filesystem::path m_correctMiningRewardPath;  ///< Path to correct mining reward info file
@@ -0,0 +1,115 @@
+#include "CacheFolder.h"
+#include <libdevcore/CommonIO.h>
+#include <retesteth/EthChecks.h>
+#include <boost/filesystem.hpp>
+#include <algorithm>
+#include <ctime>
+
+using namespace std;
+using namespace test::debug;
+namespace fs = boost::filesystem;
+
+namespace
+{
+struct CacheEntry
+{
+    std::time_t lastUsed;
+    size_t useOrder;  // 0 if not used by this run
+    uintmax_t size;
+    fs::path path;
+};
+}  // namespace
+
+namespace test
+{
+CacheFolder::CacheFolder(fs::path const& _dir, size_t _maxBytes, string const& _name)
+  : m_dir(_dir), m_name(_name), m_maxBytes(_maxBytes), m_writtenBytes(_maxBytes)
+{}
+
+fs::path CacheFolder::entryPath(string const& _key) const
+{
+    return m_dir / _key.substr(0, 2) / _key;
+}
+
+void CacheFolder::markUsed(string const& _key) const
+{
+    boost::system::error_code ec;
+    fs::last_write_time(entryPath(_key), std::time(nullptr), ec);
+    std::lock_guard<std::mutex> lock(m_useMutex);
+    m_useOrder[_key] = ++m_useCounter;
+}
+
+size_t CacheFolder::useOrder(string const& _key) const
+{
+    std::lock_guard<std::mutex> lock(m_useMutex);
+    auto const it = m_useOrder.find(_key);
+    return it == m_useOrder.end() ? 0 : it->second;
+}
+
+void CacheFolder::write(string const& _key, string const& _data)
+{
+    // Readers see either no file or the complete one
+    dev::writeFile(entryPath(_key), dev::bytesConstRef(_data), true);
+    {
+        std::lock_guard<std::mutex> lock(m_useMutex);
+        m_useOrder[_key] = ++m_useCounter;
+    }
+
+    // The first write of the run scans the folder, then every 1/8 of the limit
+    bool needEviction = false;
+    {
+        std::lock_guard<std::mutex> lock(m_evictMutex);
+        m_writtenBytes += _data.size();
+        needEviction = m_writtenBytes > m_maxBytes / 8;
+    }
+    if (needEviction)
+        evict();
+}
+
+void CacheFolder::evict()
+{
+    std::lock_guard<std::mutex> lock(m_evictMutex);
+    m_writtenBytes = 0;
+
+    std::vector<CacheEntry> entries;
+    uintmax_t totalSize = 0;
+    boost::system::error_code ec;
+    for (fs::recursive_directory_iterator it(m_dir, ec), end; !ec && it != end; it.increment(ec))
+    {
+        // Skip unfinished writes of other processes
+        if (!fs::is_regular_file(it->path(), ec) || it->path().filename().string().find('-') != string::npos)
+            continue;
+        string const entryKey = it->path().filename().string();
+        CacheEntry entry{fs::last_write_time(it->path(), ec), useOrder(entryKey), fs::file_size(it->path(), ec), it->path()};
+        if (ec)
+            continue;
+        totalSize += entry.size;
+        entries.emplace_back(std::move(entry));
+    }
+    if (totalSize <= m_maxBytes)
+        return;
+
+    // Remove least recently used entries leaving some space for new ones
+    std::sort(entries.begin(), entries.end(), [](CacheEntry const& _a, CacheEntry const& _b) {
+        if (_a.lastUsed != _b.lastUsed)
+            return _a.lastUsed < _b.lastUsed;
+        if (_a.useOrder != _b.useOrder)
+            return _a.useOrder < _b.useOrder;
+        return _a.path < _b.path;
+    });
+    uintmax_t const target = m_maxBytes - m_maxBytes / 10;
+    size_t removed = 0;
+    for (auto const& entry : entries)
+    {
+        if (totalSize <= target)
+            break;
+        if (fs::remove(entry.path, ec))
+        {
+            totalSize -= entry.size;
+            removed++;
+        }
+    }
+    ETH_DC_MESSAGE(DC::LOWLOG, m_name + " removed " + to_string(removed) + " entries from " + m_dir.string());
+}
+
+}  // namespace test
@@ -0,0 +1,43 @@
+#pragma once
+#include <boost/filesystem/path.hpp>
+#include <map>
+#include <mutex>
+#include <string>
+
+namespace test
+{
+// Folder of content addressed cache entries bound by a size limit
+// Entries are files <dir>/<key[0..2]>/<key> written with atomic rename,
+// so the folder could be shared by worker threads and parallel retesteth runs
+// The least recently used entries are removed when the folder grows over the limit
+class CacheFolder
+{
+public:
+    // Empty _dir disables the folder, _name is used in log messages
+    CacheFolder(boost::filesystem::path const& _dir, size_t _maxBytes, std::string const& _name);
+    bool enabled() const { return !m_dir.empty(); }
+
+    boost::filesystem::path entryPath(std::string const& _key) const;
+
+    // Mark an entry that was read as recently used
+    void markUsed(std::string const& _key) const;
+
+    // Atomically write the entry and remove old entries if needed, throws on write errors
+    void write(std::string const& _key, std::string const& _data);
+    void evict();
+
+private:
+    size_t useOrder(std::string const& _key) const;
+    boost::filesystem::path m_dir;
+    std::string m_name;
+    size_t m_maxBytes;
+    size_t m_writtenBytes;  // since the last eviction scan
+    std::mutex m_evictMutex;
+
+    // File times have one second resolution, entries used by this run are ordered by use
+    mutable std::mutex m_useMutex;
+    mutable std::map<std::string, size_t> m_useOrder;
+    mutable size_t m_useCounter = 0;
+};
+
+}  // namespace test
@@ -0,0 +1,315 @@
+#include "CompressedFile.h"
+#include <libdevcore/CommonIO.h>
+#include <retesteth/Options.h>
+#include <fstream>
+#include <stdexcept>
+#include <vector>
+#include <zlib.h>
+#ifdef ZSTD
+#include <zstd.h>
+#endif
+
+using namespace std;
+using namespace dev;
+namespace fs = boost::filesystem;
+
+namespace
+{
+size_t const c_bufferSize = 64 * 1024;
+
+string const c_gzipExtension = ".gz";
+string const c_zstdExtension = ".zst";
+
+#ifndef ZSTD
+[[noreturn]] void throwNoZstd()
+{
+    throw std::runtime_error("retesteth is built without zstd support, rebuild with -DZSTD=ON to use .zst test files");
+}
+#endif
+
+// Decompresses the file into a fixed size buffer on each underflow
+class DecompressBuf : public std::streambuf
+{
+public:
+    DecompressBuf(fs::path const& _file, test::FileCompression _type)
+      : m_file(_file.string(), std::ios::binary), m_type(_type), m_in(c_bufferSize), m_out(c_bufferSize)
+    {
+        if (!m_file.is_open())
+            throw std::runtime_error("Could not open file: " + _file.string());
+        if (m_type == test::FileCompression::Gzip)
+        {
+            m_zlib.zalloc = Z_NULL;
+            m_zlib.zfree = Z_NULL;
+            m_zlib.opaque = Z_NULL;
+            m_zlib.next_in = Z_NULL;
+            m_zlib.avail_in = 0;
+            // 15 + 32 detects gzip or zlib header
+            if (inflateInit2(&m_zlib, 15 + 32) != Z_OK)
+                throw std::runtime_error("Could not init gzip decompression");
+        }
+        else
+        {
+#ifdef ZSTD
+            m_zstd = ZSTD_createDStream();
+            if (m_zstd == nullptr)
+                throw std::runtime_error("Could not init zstd decompression");
+            m_zin = {m_in.data(), 0, 0};
+#else
+            throwNoZstd();
+#endif
+        }
+    }
+    ~DecompressBuf()
+    {
+        if (m_type == test::FileCompression::Gzip)
+            inflateEnd(&m_zlib);
+#ifdef ZSTD
+        if (m_zstd != nullptr)
+            ZSTD_freeDStream(m_zstd);
+#endif
+    }
+
+protected:
+    int_type underflow() override
+    {
+        if (gptr() < egptr())
+            return traits_type::to_int_type(*gptr());
+        size_t produced = 0;
+        while (produced == 0 && !m_finished)
+            produced = m_type == test::FileCompression::Gzip ? inflateNext() : zstdNext();
+        if (produced == 0)
+            return traits_type::eof();
+        setg(m_out.data(), m_out.data(), m_out.data() + produced);
+        return traits_type::to_int_type(*gptr());
+    }
+
+private:
+    size_t readInput()
+    {
+        m_file.read(m_in.data(), m_in.size());
+        return m_file.gcount();
+    }
+
+    size_t inflateNext()
+    {
+        if (m_zlib.avail_in == 0)
+        {
+            m_zlib.next_in = reinterpret_cast<Bytef*>(m_in.data());
+            m_zlib.avail_in = readInput();
+            if (m_zlib.avail_in == 0)
+                throw std::runtime_error("gzip stream is truncated");
+        }
+        m_zlib.next_out = reinterpret_cast<Bytef*>(m_out.data());
+        m_zlib.avail_out = m_out.size();
+        int const res = inflate(&m_zlib, Z_NO_FLUSH);
+        if (res == Z_STREAM_END)
+        {
+            // Concatenated gzip members are read as one stream
+            if (m_zlib.avail_in == 0 && m_file.peek() == EOF)
+                m_finished = true;
+            else
+                inflateReset(&m_zlib);
+        }
+        else if (res != Z_OK && res != Z_BUF_ERROR)
+            throw std::runtime_error(string("gzip: ") + (m_zlib.msg != nullptr ? m_zlib.msg : "data error"));
+        return m_out.size() - m_zlib.avail_out;
+    }
+
+    size_t zstdNext()
+    {
+#ifdef ZSTD
+        if (m_zin.pos == m_zin.size)
+        {
+            m_zin.size = readInput();
+            m_zin.pos = 0;
+            if (m_zin.size == 0)
+            {
+                if (!m_frameEnded)
+                    throw std::runtime_error("zstd stream is truncated");
+                m_finished = true;
+                return 0;
+            }
+        }
+        ZSTD_outBuffer out = {m_out.data(), m_out.size(), 0};
+        size_t const res = ZSTD_decompressStream(m_zstd, &out, &m_zin);
+        if (ZSTD_isError(res))
+            throw std::runtime_error(string("zstd: ") + ZSTD_getErrorName(res));
+        m_frameEnded = (res == 0);
+        return out.pos;
+#else
+        throwNoZstd();
+#endif
+    }
+
+    std::ifstream m_file;
+    test::FileCompression m_type;
+    std::vector<char> m_in;
+    std::vector<char> m_out;
+    bool m_finished = false;
+    z_stream m_zlib;
+#ifdef ZSTD
+    ZSTD_DStream* m_zstd = nullptr;
+    ZSTD_inBuffer m_zin;
+    bool m_frameEnded = false;
+#endif
+};
+
+class DecompressStream : public std::istream
+{
+public:
+    DecompressStream(fs::path const& _file, test::FileCompression _type) : std::istream(nullptr), m_buf(_file, _type)
+    {
+        rdbuf(&m_buf);
+    }
+
+private:
+    DecompressBuf m_buf;
+};
+
+string gzipContent(string const& _content)
+{
+    z_stream stream;
+    stream.zalloc = Z_NULL;
+    stream.zfree = Z_NULL;
+    stream.opaque = Z_NULL;
+    // 15 + 16 writes gzip header
+    if (deflateInit2(&stream, Z_BEST_COMPRESSION, Z_DEFLATED, 15 + 16, 8, Z_DEFAULT_STRATEGY) != Z_OK)
+        throw std::runtime_error("Could not init gzip compression");
+    string res(deflateBound(&stream, _content.size()), '\0');
+    stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(_content.data()));
+    stream.avail_in = _content.size();
+    stream.next_out = reinterpret_cast<Bytef*>(res.data());
+    stream.avail_out = res.size();
+    int const ret = deflate(&stream, Z_FINISH);
+    res.resize(stream.total_out);
+    deflateEnd(&stream);
+    if (ret != Z_STREAM_END)
+        throw std::runtime_error("gzip compression failed");
+    return res;
+}
+
+string zstdContent(string const& _content)
+{
+#ifdef ZSTD
+    string res(ZSTD_compressBound(_content.size()), '\0');
+    size_t const size = ZSTD_compress(res.data(), res.size(), _content.data(), _content.size(), 10);
+    if (ZSTD_isError(size))
+        throw std::runtime_error(string("zstd: ") + ZSTD_getErrorName(size));
+    res.resize(size);
+    return res;
+#else
+    (void)_content;
+    throwNoZstd();
+#endif
+}
+
+fs::path withCompression(fs::path const& _plainFile, test::FileCompression _type)
+{
+    return _plainFile.string() + test::compressionExtension(_type);
+}
+}  // namespace
+
+namespace test
+{
+FileCompression fileCompression(fs::path const& _file)
+{
+    if (_file.extension() == c_gzipExtension)
+        return FileCompression::Gzip;
+    if (_file.extension() == c_zstdExtension)
+        return FileCompression::Zstd;
+    return FileCompression::None;
+}
+
+string compressionExtension(FileCompression _type)
+{
+    switch (_type)
+    {
+    case FileCompression::Gzip: return c_gzipExtension;
+    case FileCompression::Zstd: return c_zstdExtension;
+    default: return string();
+    }
+}
+
+fs::path withoutCompression(fs::path const& _file)
+{
+    if (fileCompression(_file) == FileCompression::None)
+        return _file;
+    return _file.parent_path() / _file.stem();
+}
+
+string testFileStem(fs::path const& _file)
+{
+    return withoutCompression(_file).stem().string();
+}
+
+fs::path findTestFile(fs::path const& _plainFile)
+{
+    for (auto const type : {FileCompression::None, FileCompression::Gzip, FileCompression::Zstd})
+    {
+        fs::path const file = withCompression(_plainFile, type);
+        if (fs::exists(file))
+            return file;
+    }
+    return _plainFile;
+}
+
+std::unique_ptr<std::istream> openTestFile(fs::path const& _file)
+{
+    std::unique_ptr<std::istream> stream;
+    FileCompression const type = fileCompression(_file);
+    if (type == FileCompression::None)
+    {
+        auto file = std::make_unique<std::ifstream>(_file.string(), std::ios::binary);
+        if (!file->is_open())
+            throw std::runtime_error("Could not open file: " + _file.string());
+        stream = std::move(file);
+    }
+    else
+        stream = std::make_unique<DecompressStream>(_file, type);
+    stream->exceptions(std::ios::badbit);
+    return stream;
+}
+
+string compressContent(string const& _content, FileCompression _type)
+{
+    switch (_type)
+    {
+    case FileCompression::Gzip: return gzipContent(_content);
+    case FileCompression::Zstd: return zstdContent(_content);
+    default: return _content;
+    }
+}
+
+FileCompression fillCompression()
+{
+    string const& option = Options::get().fillcompressed;
+    if (option == "gz")
+        return FileCompression::Gzip;
+    if (option == "zst")
+        return FileCompression::Zstd;
+    return FileCompression::None;
+}
+
+fs::path writeTestFile(fs::path const& _plainFile, string const& _content)
+{
+    FileCompression const type = fillCompression();
+    fs::path const file = withCompression(_plainFile, type);
+    if (type == FileCompression::None)
+        writeFile(file, bytesConstRef(_content));
+    else
+    {
+        string const compressed = compressContent(_content, type);
+        writeFile(file, bytesConstRef(compressed));
+    }
+
+    // Leave one variant of the test so the readers never pick an outdated one
+    for (auto const other : {FileCompression::None, FileCompression::Gzip, FileCompression::Zstd})
+    {
+        boost::system::error_code ec;
+        if (other != type)
+            fs::remove(withCompression(_plainFile, other), ec);
+    }
+    return file;
+}
+
+}  // namespace test
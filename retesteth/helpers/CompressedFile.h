@@ -0,0 +1,43 @@
+#pragma once
+#include <boost/filesystem.hpp>
+#include <istream>
+#include <memory>
+#include <string>
+
+namespace test
+{
+enum class FileCompression
+{
+    None,
+    Gzip,
+    Zstd
+};
+
+/// Compression of the test file by its extension (.gz, .zst)
+FileCompression fileCompression(boost::filesystem::path const& _file);
+std::string compressionExtension(FileCompression _type);
+
+/// Path without the compression extension: test.json.gz -> test.json
+boost::filesystem::path withoutCompression(boost::filesystem::path const& _file);
+
+/// Test name of the file: test.json.gz -> test
+std::string testFileStem(boost::filesystem::path const& _file);
+
+/// Existing _plainFile or its compressed variant. _plainFile if none of them exist
+boost::filesystem::path findTestFile(boost::filesystem::path const& _plainFile);
+
+/// Stream of the file content, compressed files are decompressed while reading through a bounded buffer
+/// Read errors are thrown from the stream operations
+std::unique_ptr<std::istream> openTestFile(boost::filesystem::path const& _file);
+
+/// Compress the content into .gz or .zst file format
+std::string compressContent(std::string const& _content, FileCompression _type);
+
+/// Format selected by --fillcompressed
+FileCompression fillCompression();
+
+/// Write filled test in the --fillcompressed format and remove its variants in other formats
+/// Returns the written path
+boost::filesystem::path writeTestFile(boost::filesystem::path const& _plainFile, std::string const& _content);
+
+}  // namespace test
@@ -0,0 +1,101 @@
+#include "LogSink.h"
+#include <iostream>
+
+using namespace std;
+
+namespace
+{
+size_t const c_ringSize = 4096;
+std::atomic<bool> g_sinkClosed = false;
+}  // namespace
+
+namespace test
+{
+LogSink& LogSink::get()
+{
+    static LogSink instance;
+    return instance;
+}
+
+LogSink::LogSink() : m_ring(c_ringSize)
+{
+    m_writer = std::thread(&LogSink::writerLoop, this);
+}
+
+LogSink::~LogSink()
+{
+    g_sinkClosed = true;
+    m_stop = true;
+    m_pushed++;
+    m_pushed.notify_one();
+    m_writer.join();
+}
+
+void LogSink::write(string&& _line)
+{
+    // Write directly when logging from static destructors
+    if (g_sinkClosed)
+    {
+        std::cout << _line << std::flush;
+        return;
+    }
+
+    // The ring is full, sleep until the writer drains it
+    size_t written = m_written;
+    while (!m_ring.tryPush(std::move(_line)))
+    {
+        m_written.wait(written);
+        written = m_written;
+    }
+    m_pushed++;
+    m_pushed.notify_one();
+}
+
+void LogSink::flush()
+{
+    if (g_sinkClosed || std::this_thread::get_id() == m_writer.get_id())
+        return;
+    size_t const target = m_pushed;
+    size_t written = m_written;
+    while (written < target)
+    {
+        m_written.wait(written);
+        written = m_written;
+    }
+}
+
+void LogSink::writerLoop()
+{
+    string line;
+    string buffer;
+    size_t written = 0;
+    while (true)
+    {
+        size_t const seen = m_pushed;
+        while (m_ring.tryPop(line))
+        {
+            buffer += line;
+            written++;
+        }
+        if (!buffer.empty())
+        {
+            std::cout.write(buffer.data(), buffer.size());
+            std::cout.flush();
+            buffer.clear();
+        }
+        m_written = written;
+        m_written.notify_all();
+
+        if (m_stop)
+        {
+            // Producers might still finish their pushes
+            while (m_ring.tryPop(line))
+                std::cout << line;
+            std::cout.flush();
+            return;
+        }
+        m_pushed.wait(seen);
+    }
+}
+
+}  // namespace test
@@ -0,0 +1,88 @@
+#pragma once
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+
+namespace test
+{
+// Bounded lock-free queue for many producers and a single consumer
+template <class T>
+class MPSCRing
+{
+public:
+    explicit MPSCRing(size_t _capacityPow2) : m_mask(_capacityPow2 - 1), m_cells(new Cell[_capacityPow2])
+    {
+        for (size_t i = 0; i < _capacityPow2; i++)
+            m_cells[i].seq.store(i, std::memory_order_relaxed);
+    }
+
+    // False if the ring is full
+    bool tryPush(T&& _value)
+    {
+        size_t pos = m_head.load(std::memory_order_relaxed);
+        Cell* cell;
+        while (true)
+        {
+            cell = &m_cells[pos & m_mask];
+            size_t const seq = cell->seq.load(std::memory_order_acquire);
+            std::ptrdiff_t const diff = (std::ptrdiff_t)seq - (std::ptrdiff_t)pos;
+            if (diff == 0)
+            {
+                if (m_head.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                    break;
+            }
+            else if (diff < 0)
+                return false;
+            else
+                pos = m_head.load(std::memory_order_relaxed);
+        }
+        cell->value = std::move(_value);
+        cell->seq.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Must be called from the consumer thread only
+    bool tryPop(T& _value)
+    {
+        Cell& cell = m_cells[m_tail & m_mask];
+        if (cell.seq.load(std::memory_order_acquire) != m_tail + 1)
+            return false;
+        _value = std::move(cell.value);
+        cell.seq.store(m_tail + m_mask + 1, std::memory_order_release);
+        m_tail++;
+        return true;
+    }
+
+private:
+    struct Cell
+    {
+        std::atomic<size_t> seq;
+        T value;
+    };
+    size_t const m_mask;
+    std::unique_ptr<Cell[]> m_cells;
+    std::atomic<size_t> m_head = 0;
+    size_t m_tail = 0;
+};
+
+// Log lines from worker threads are queued and written to stdout by one writer thread
+class LogSink
+{
+public:
+    static LogSink& get();
+    void write(std::string&& _line);
+    void flush();  // Wait until all queued lines are written
+    ~LogSink();
+
+private:
+    LogSink();
+    void writerLoop();
+    MPSCRing<std::string> m_ring;
+    std::atomic<size_t> m_pushed = 0;
+    std::atomic<size_t> m_written = 0;
+    std::atomic<bool> m_stop = false;
+    std::thread m_writer;
+};
+
+}  // namespace test
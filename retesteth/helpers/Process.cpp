@@ -0,0 +1,189 @@
+#include "Process.h"
+#include <retesteth/EthChecks.h>
+#include <cerrno>
+#include <cstring>
+#include <map>
+#include <mutex>
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <poll.h>
+#include <spawn.h>
+#include <sys/wait.h>
+#include <unistd.h>
+extern char** environ;
+#endif
+
+using namespace std;
+namespace fs = boost::filesystem;
+
+namespace
+{
+std::mutex g_executablesMutex;
+std::map<string, fs::path> g_executables;
+
+bool isExecutable(fs::path const& _path)
+{
+#if defined(_WIN32)
+    return fs::exists(_path);
+#else
+    return access(_path.c_str(), X_OK) == 0 && !fs::is_directory(_path);
+#endif
+}
+
+fs::path resolveExecutable(string const& _name)
+{
+    if (_name.find('/') != string::npos)
+        return isExecutable(_name) ? fs::path(_name) : fs::path();
+
+    char const* env = getenv("PATH");
+    string const path = env ? env : "/usr/local/bin:/usr/bin:/bin";
+    size_t begin = 0;
+    while (begin <= path.size())
+    {
+        size_t end = path.find(':', begin);
+        if (end == string::npos)
+            end = path.size();
+        string const dir = end > begin ? path.substr(begin, end - begin) : ".";
+        fs::path const candidate = fs::path(dir) / _name;
+        if (isExecutable(candidate))
+            return candidate;
+        begin = end + 1;
+    }
+    return fs::path();
+}
+
+#if !defined(_WIN32)
+// pipe2(O_CLOEXEC) is linux only
+bool makePipe(int _fds[2])
+{
+    if (pipe(_fds) != 0)
+        return false;
+    if (fcntl(_fds[0], F_SETFD, FD_CLOEXEC) != 0 || fcntl(_fds[1], F_SETFD, FD_CLOEXEC) != 0)
+    {
+        close(_fds[0]);
+        close(_fds[1]);
+        return false;
+    }
+    return true;
+}
+#endif
+}  // namespace
+
+namespace test
+{
+fs::path findExecutable(string const& _name)
+{
+    {
+        std::lock_guard<std::mutex> lock(g_executablesMutex);
+        auto const it = g_executables.find(_name);
+        if (it != g_executables.end())
+            return it->second;
+    }
+
+    // Only remember found executables, a missing one could be installed later
+    fs::path const resolved = resolveExecutable(_name);
+    if (!resolved.empty())
+    {
+        std::lock_guard<std::mutex> lock(g_executablesMutex);
+        g_executables.emplace(_name, resolved);
+    }
+    return resolved;
+}
+
+ProcessResult runProcess(vector<string> const& _argv, ProcessStderr _stderr, fs::path const& _stdin)
+{
+    ProcessResult result;
+#if defined(_WIN32)
+    (void)_argv;
+    (void)_stderr;
+    (void)_stdin;
+    ETH_FAIL_MESSAGE("runProcess() has not been implemented for Windows.");
+#else
+    ETH_FAIL_REQUIRE_MESSAGE(!_argv.empty(), "runProcess: empty argument!");
+    fs::path const exe = findExecutable(_argv.at(0));
+    if (exe.empty())
+        ETH_FAIL_MESSAGE("Command `" + _argv.at(0) + "` does not found!");
+
+    bool const captureErr = _stderr == ProcessStderr::Capture;
+    int outPipe[2];
+    int errPipe[2] = {-1, -1};
+    if (!makePipe(outPipe))
+        ETH_FAIL_MESSAGE("runProcess: failed to create a pipe for " + _argv.at(0));
+    if (captureErr && !makePipe(errPipe))
+    {
+        close(outPipe[0]);
+        close(outPipe[1]);
+        ETH_FAIL_MESSAGE("runProcess: failed to create a pipe for " + _argv.at(0));
+    }
+
+    posix_spawn_file_actions_t actions;
+    posix_spawn_file_actions_init(&actions);
+    posix_spawn_file_actions_adddup2(&actions, outPipe[1], STDOUT_FILENO);
+    if (captureErr)
+        posix_spawn_file_actions_adddup2(&actions, errPipe[1], STDERR_FILENO);
+    if (!_stdin.empty())
+        posix_spawn_file_actions_addopen(&actions, STDIN_FILENO, _stdin.c_str(), O_RDONLY, 0);
+
+    vector<char*> argv;
+    argv.reserve(_argv.size() + 1);
+    for (auto const& arg : _argv)
+        argv.emplace_back(const_cast<char*>(arg.c_str()));
+    argv.emplace_back(nullptr);
+
+    pid_t pid;
+    int const spawnError = posix_spawn(&pid, exe.c_str(), &actions, nullptr, argv.data(), environ);
+    posix_spawn_file_actions_destroy(&actions);
+    close(outPipe[1]);
+    if (captureErr)
+        close(errPipe[1]);
+    if (spawnError != 0)
+    {
+        close(outPipe[0]);
+        if (captureErr)
+            close(errPipe[0]);
+        ETH_FAIL_MESSAGE("Failed to run " + _argv.at(0) + ": " + strerror(spawnError));
+    }
+
+    // Read both pipes until the child closes them
+    pollfd fds[2] = {{outPipe[0], POLLIN, 0}, {errPipe[0], POLLIN, 0}};
+    string* targets[2] = {&result.out, &result.err};
+    nfds_t const nfds = captureErr ? 2 : 1;
+    size_t openPipes = nfds;
+    char buffer[65536];
+    while (openPipes > 0)
+    {
+        if (poll(fds, nfds, -1) < 0)
+        {
+            if (errno == EINTR)
+                continue;
+            break;
+        }
+        for (nfds_t i = 0; i < nfds; i++)
+        {
+            if (fds[i].fd < 0 || fds[i].revents == 0)
+                continue;
+            ssize_t const size = read(fds[i].fd, buffer, sizeof(buffer));
+            if (size > 0)
+                targets[i]->append(buffer, size);
+            else if (size == 0 || errno != EINTR)
+            {
+                close(fds[i].fd);
+                fds[i].fd = -1;
+                openPipes--;
+            }
+        }
+    }
+    for (nfds_t i = 0; i < nfds; i++)
+        if (fds[i].fd >= 0)
+            close(fds[i].fd);
+
+    int status = 0;
+    while (waitpid(pid, &status, 0) < 0 && errno == EINTR)
+        ;
+    result.exitCode = status;
+#endif
+    return result;
+}
+
+}  // namespace test
@@ -0,0 +1,31 @@
+#pragma once
+#include <boost/filesystem.hpp>
+#include <string>
+#include <vector>
+
+namespace test
+{
+/// Path to an executable from PATH (or _name itself if it is a path)
+/// Found executables are resolved once and cached. Empty path if not found
+boost::filesystem::path findExecutable(std::string const& _name);
+
+struct ProcessResult
+{
+    int exitCode = 0;  // waitpid status, 0 on success
+    std::string out;
+    std::string err;   // only if stderr is captured
+};
+
+enum class ProcessStderr
+{
+    Inherit,
+    Capture
+};
+
+/// Run _argv[0] with arguments without a shell and read its output through pipes
+/// stdin of the process is read from the _stdin file if it is set
+/// Safe to call from all threads concurrently
+ProcessResult runProcess(std::vector<std::string> const& _argv, ProcessStderr _stderr = ProcessStderr::Inherit,
+    boost::filesystem::path const& _stdin = boost::filesystem::path());
+
+}  // namespace test
@@ -1,5 +1,6 @@
 #include <BuildInfo.h>
 #include <fcntl.h>
+#include <boost/algorithm/string/join.hpp>
 #include <boost/algorithm/string/trim.hpp>
 #include <boost/uuid/uuid_generators.hpp>  // generators
 #include <boost/uuid/uuid_io.hpp>
@@ -8,7 +9,10 @@
 #include <libdevcore/CommonIO.h>
 #include <retesteth/EthChecks.h>
 #include <retesteth/Options.h>
+#include <retesteth/helpers/CompressedFile.h>
+#include <retesteth/helpers/Process.h>
 #include <retesteth/helpers/TestHelper.h>
+#include <retesteth/helpers/TraceSpan.h>
 #include <boost/test/unit_test.hpp>
 
 using namespace std;
@@ -22,7 +26,8 @@ Json::Value readJson(fs::path const& _file)
 {
     Json::Value v;
     Json::Reader reader;
-    string s = dev::contentsString(_file);
+    auto const stream = openTestFile(_file);
+    string s((std::istreambuf_iterator<char>(*stream)), std::istreambuf_iterator<char>());
     string const& fname = _file.filename().c_str();
     ETH_ERROR_REQUIRE_MESSAGE(s.length() > 0, "Contents of " + fname +
                                                   " is empty. Have you cloned the 'tests' repo branch "
@@ -35,14 +40,16 @@ Json::Value readJson(fs::path const& _file)
 #endif
 
 /// Safely read the json file into DataObject
+/// The file is streamed into the parser, .gz and .zst files are decompressed on the way
 spDataObject readJsonData(fs::path const& _file, CJOptions const& _opt)
 {
+    ETH_TRACE_SPAN("readJsonData");
     try
     {
-        const string s = dev::contentsString(_file);
-        ETH_ERROR_REQUIRE_MESSAGE(
-            s.length() > 0, "Contents of " + _file.string() + " is empty. Trying to parse empty file. (forgot --filltests?)");
-        return dataobject::ConvertJsoncppStringToData(s, _opt);
+        auto const stream = openTestFile(_file);
+        ETH_ERROR_REQUIRE_MESSAGE(stream->peek() != EOF,
+            "Contents of " + _file.string() + " is empty. Trying to parse empty file. (forgot --filltests?)");
+        return dataobject::ConvertJsonStreamToData(*stream, _opt);
     }
     catch (std::exception const& _ex)
     {
@@ -56,10 +63,10 @@ spDataObject readYamlData(fs::path const& _file, bool _sort)
 {
     try
     {
-        const string s = dev::contentsString(_file);
-        ETH_ERROR_REQUIRE_MESSAGE(
-            s.length() > 0, "Contents of " + _file.string() + " is empty. Trying to parse empty file. (forgot --filltests?)");
-        return dataobject::ConvertYamlToData(YAML::Load(s), _sort);
+        auto const stream = openTestFile(_file);
+        ETH_ERROR_REQUIRE_MESSAGE(stream->peek() != EOF,
+            "Contents of " + _file.string() + " is empty. Trying to parse empty file. (forgot --filltests?)");
+        return dataobject::ConvertYamlStreamToData(*stream, _sort);
     }
     catch (std::exception const& _ex)
     {
@@ -72,13 +79,14 @@ spDataObject readAutoDataWithoutOptions(boost::filesystem::path const& _file, bo
 {
     try
     {
-        const string s = dev::contentsString(_file);
-        if (s.length() == 0)
+        auto const stream = openTestFile(_file);
+        if (stream->peek() == EOF)
             std::cerr << "Contents of " + _file.string() + " is empty. Trying to parse empty file." << std::endl;
-        if (_file.extension() == ".json")
-            return dataobject::ConvertJsoncppStringToData(s);
-        else if (_file.extension() == ".yml")
-            return dataobject::ConvertYamlToData(YAML::Load(s), _sort);
+        auto const extension = withoutCompression(_file).extension();
+        if (extension == ".json")
+            return dataobject::ConvertJsonStreamToData(*stream);
+        else if (extension == ".yml")
+            return dataobject::ConvertYamlStreamToData(*stream, _sort);
         std::cerr << "Unknown test file: " << _file.string() << std::endl;
     }
     catch (std::exception const& _ex)
@@ -95,7 +103,7 @@ vector<fs::path> getFiles(fs::path const& _dirPath, set<string> const& _extentio
     {
         if (!_particularFile.empty())
         {
-            const fs::path file = _dirPath / (_particularFile + ext);
+            const fs::path file = findTestFile(_dirPath / (_particularFile + ext));
             if (fs::exists(file))
                 files.emplace_back(file);
         }
@@ -106,7 +114,7 @@ vector<fs::path> getFiles(fs::path const& _dirPath, set<string> const& _extentio
                 using fsIterator = fs::directory_iterator;
                 for (fsIterator it(_dirPath); it != fsIterator(); ++it)
                 {
-                    if (fs::is_regular_file(it->path()) && it->path().extension() == ext)
+                    if (fs::is_regular_file(it->path()) && withoutCompression(it->path()).extension() == ext)
                         files.emplace_back(it->path());
                 }
             }
@@ -332,8 +340,7 @@ string prepareLLLCVersionString()
     if (test::checkCmdExist("lllc"))
     {
         int exitCode;
-        const string cmd = "lllc --version";
-        const string result = test::executeCmd(cmd, exitCode);
+        const string result = test::executeProcess({"lllc", "--version"}, exitCode);
         const string::size_type pos = result.rfind("Version");
         if (pos != string::npos)
         {
@@ -357,8 +364,7 @@ string prepareSolidityVersionString()
     if (test::checkCmdExist("solc"))
     {
         int exitCode;
-        const string cmd = "solc --version";
-        const string result = test::executeCmd(cmd, exitCode);
+        const string result = test::executeProcess({"solc", "--version"}, exitCode);
         const string cVersion  = "Version";
         const string::size_type pos = result.rfind(cVersion);
         if (pos != string::npos)
@@ -438,11 +444,8 @@ bool checkCmdExist(std::string const& _command)
     else
         cmd = _command;
 
-    const string checkCmd = string("which " + cmd + " > /dev/null 2>&1");
-    const bool checkBoost = fs::exists(cmd);
-    if (!checkBoost && system(checkCmd.c_str()))
-        return false;
-    return true;
+    // Absolute and relative paths to a file are accepted as is
+    return fs::exists(cmd) || !test::findExecutable(cmd).empty();
 }
 
 mutex g_popenmutex;
@@ -456,7 +459,6 @@ string executeCmd(string const& _command, int& _exitCode, ExecCMDWarning _warnin
     char output[1024];
     ETH_FAIL_REQUIRE_MESSAGE(!_command.empty(), "executeCmd: empty argument!");
 
-    // TODO: do this check only once and remember that it exist? syscalls are expensive
     if (!test::checkCmdExist(_command))
         ETH_FAIL_MESSAGE("Command `" + _command + "` does not found!");
 
@@ -495,6 +497,25 @@ string executeCmd(string const& _command, int& _exitCode, ExecCMDWarning _warnin
 #endif
 }
 
+string executeProcess(vector<string> const& _argv, int& _exitCode, ExecCMDWarning _warningOnEmpty)
+{
+    ProcessResult const res = runProcess(_argv);
+    string const command = boost::algorithm::join(_argv, " ");
+    if (res.out.empty() && _warningOnEmpty == ExecCMDWarning::WarningOnEmptyResult)
+        ETH_WARNING("Reading empty result for " + command);
+
+    _exitCode = res.exitCode;
+    if (_exitCode != 0)
+    {
+        const string msg = "The command '" + command + "' exited with " + toString(_exitCode) + " code.";
+        if (_warningOnEmpty != ExecCMDWarning::NoWarningNoError)
+            ETH_ERROR_MESSAGE(msg);
+        else
+            return msg;
+    }
+    return boost::trim_copy(res.out);
+}
+
 /// Explode string into array of strings by `delim`
 std::vector<std::string> explode(std::string const& s, char delim)
 {
@@ -529,8 +550,7 @@ std::set<std::string> explodeIntoSet(std::string const& s, char delim)
 //https://stackoverflow.com/questions/26852198/getting-the-pid-from-popen
 FILE* popen2(string const& _command, vector<string> const& _args, string const& _type, int& _pid, popenOutput _debug)
 {
-    string testIfCmdExist = "which " + _command;
-    if (system(testIfCmdExist.c_str()) == 256)
+    if (test::findExecutable(_command).empty())
         ETH_FAIL_MESSAGE("Command " + _command + " not found in the system!");
 
     pid_t child_pid;
@@ -26,7 +26,7 @@ spDataObject readJsonData(boost::filesystem::path const& _file, dataobject::CJOp
 spDataObject readYamlData(boost::filesystem::path const& _file, bool _sort = false);
 spDataObject readAutoDataWithoutOptions(boost::filesystem::path const& _file, bool _sort = false);
 
-/// Get files from directory
+/// Get files from directory, including .gz and .zst compressed variants of the extensions
 std::vector<boost::filesystem::path> getFiles(boost::filesystem::path const& _dirPath, std::set<std::string> const& _extentionMask, std::string const& _particularFile = {});
 
 /// Get test repo path from ETHEREUM_TEST_PATH environment variable
@@ -70,6 +70,8 @@ enum class ExecCMDWarning
     NoWarningNoError
 };
 std::string executeCmd(std::string const& _command, int& _exitCode, ExecCMDWarning _warningOnEmpty = ExecCMDWarning::WarningOnEmptyResult);
+/// run executable with arguments directly, without a shell
+std::string executeProcess(std::vector<std::string> const& _argv, int& _exitCode, ExecCMDWarning _warningOnEmpty = ExecCMDWarning::WarningOnEmptyResult);
 
 // Return the vector of most looking like as _needles strings from the vector
 std::vector<std::string> levenshteinDistance(
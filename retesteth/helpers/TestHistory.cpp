@@ -0,0 +1,165 @@
+#include "TestHistory.h"
+#include <libdataobj/ConvertFile.h>
+#include <libdevcore/CommonIO.h>
+#include <libdevcore/FileSystem.h>
+#include <retesteth/EthChecks.h>
+#include <retesteth/Options.h>
+#include <boost/filesystem.hpp>
+#include <boost/filesystem/fstream.hpp>
+#include <boost/interprocess/sync/file_lock.hpp>
+#include <boost/interprocess/sync/scoped_lock.hpp>
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+using namespace std;
+using namespace dataobject;
+namespace fs = boost::filesystem;
+
+namespace
+{
+double smoothTime(double _history, double _run)
+{
+    return (_history + _run) / 2;
+}
+}  // namespace
+
+namespace test
+{
+TestHistory::TestHistory(fs::path const& _file) : m_file(_file)
+{
+    if (m_file.empty() || !fs::exists(m_file))
+        return;
+    try
+    {
+        m_times = readTimes(m_file);
+    }
+    catch (std::exception const& _ex)
+    {
+        ETH_WARNING(string("Ignoring broken test history ") + m_file.string() + ": " + _ex.what());
+    }
+}
+
+map<string, double> TestHistory::readTimes(fs::path const& _file)
+{
+    map<string, double> times;
+    spDataObject const data = ConvertJsoncppStringToData(dev::contentsString(_file));
+    if (data->type() != DataType::Object)
+        throw std::runtime_error("test history is not an object");
+    for (auto const& el : data->getSubObjects())
+        times.emplace(el->getKey(), el->asInt() / 1000.0);
+    return times;
+}
+
+TestHistory& TestHistory::get()
+{
+    static TestHistory history = []() {
+        Options const& opt = Options::get();
+        fs::path file = opt.testHistory;
+        if (file.empty())
+        {
+            fs::path const dataDir = opt.datadir.empty() ? dev::getDataDir("retesteth") : fs::path(opt.datadir);
+            file = dataDir / "testhistory.json";
+        }
+        return TestHistory(file);
+    }();
+    return history;
+}
+
+vector<size_t> TestHistory::order(vector<string> const& _tests, vector<bool> const& _slow) const
+{
+    vector<double> expected(_tests.size(), -1);
+    double knownTime = 0;
+    double longestTime = 0;
+    size_t knownCount = 0;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for (size_t i = 0; i < _tests.size(); i++)
+        {
+            auto const it = m_times.find(_tests.at(i));
+            if (it == m_times.end())
+                continue;
+            expected.at(i) = it->second;
+            knownTime += it->second;
+            longestTime = std::max(longestTime, it->second);
+            knownCount++;
+        }
+    }
+
+    double const averageTime = knownCount ? knownTime / knownCount : 0;
+    for (size_t i = 0; i < _tests.size(); i++)
+        if (expected.at(i) < 0)
+            expected.at(i) = _slow.at(i) ? longestTime + 1 : averageTime;
+
+    vector<size_t> order(_tests.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&expected](size_t _a, size_t _b) {
+        return expected.at(_a) > expected.at(_b);
+    });
+    return order;
+}
+
+void TestHistory::update(map<string, TestReport::TestResult> const& _results)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (auto const& el : _results)
+    {
+        auto const it = m_times.find(el.first);
+        if (it == m_times.end())
+            m_times.emplace(el.first, el.second.time);
+        else
+            it->second = smoothTime(it->second, el.second.time);
+        m_runTimes[el.first] = el.second.time;
+    }
+}
+
+void TestHistory::save() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_file.empty() || m_runTimes.empty())
+        return;
+    try
+    {
+        if (m_file.has_parent_path())
+            fs::create_directories(m_file.parent_path());
+        fs::path const lockPath = m_file.string() + ".lock";
+        fs::ofstream(lockPath, std::ios::app).close();
+        boost::interprocess::file_lock fileLock(lockPath.string().c_str());
+        boost::interprocess::scoped_lock<boost::interprocess::file_lock> const fileGuard(fileLock);
+
+        // Another run could have saved its times since this one has started
+        map<string, double> times = m_times;
+        if (fs::exists(m_file))
+        {
+            try
+            {
+                map<string, double> saved = readTimes(m_file);
+                for (auto const& el : m_runTimes)
+                {
+                    auto const it = saved.find(el.first);
+                    if (it == saved.end())
+                        saved.emplace(el.first, el.second);
+                    else
+                        it->second = smoothTime(it->second, el.second);
+                }
+                times = std::move(saved);
+            }
+            catch (std::exception const& _ex)
+            {
+                ETH_WARNING(string("Overwriting broken test history ") + m_file.string() + ": " + _ex.what());
+            }
+        }
+
+        spDataObject data(new DataObject(DataType::Object));
+        for (auto const& el : times)
+            (*data)[el.first] = int(std::lround(el.second * 1000));
+        string const json = data->asJson();
+        dev::writeFile(m_file, dev::bytesConstRef(json), true);
+    }
+    catch (std::exception const& _ex)
+    {
+        ETH_WARNING(string("Could not write test history: ") + _ex.what());
+    }
+}
+
+}  // namespace test
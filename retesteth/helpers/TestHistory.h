@@ -0,0 +1,41 @@
+#pragma once
+#include <retesteth/helpers/TestReport.h>
+#include <boost/filesystem/path.hpp>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace test
+{
+// Wall times of the test fillers from previous runs, kept in a small json file (test => ms)
+// Used to start the longest tests first, so a run at high -j does not end with one busy thread
+class TestHistory
+{
+public:
+    // Empty _file disables the history
+    TestHistory(boost::filesystem::path const& _file);
+    static TestHistory& get();
+
+    // Times of a history file in seconds, throws on a malformed file
+    static std::map<std::string, double> readTimes(boost::filesystem::path const& _file);
+
+    // Positions of _tests, longest expected first. Unknown tests take the average time,
+    // unknown _slow tests the longest one. Equal times keep the given order
+    std::vector<size_t> order(std::vector<std::string> const& _tests, std::vector<bool> const& _slow) const;
+
+    // Remember times of the run, smoothed with the previous runs
+    void update(std::map<std::string, TestReport::TestResult> const& _results);
+
+    // Merge times of the run into the file as it is on disk now, so parallel runs
+    // sharing one history do not drop each other's tests
+    void save() const;
+
+private:
+    boost::filesystem::path m_file;
+    mutable std::mutex m_mutex;
+    std::map<std::string, double> m_times;     // seconds
+    std::map<std::string, double> m_runTimes;  // seconds, measured in this run
+};
+
+}  // namespace test
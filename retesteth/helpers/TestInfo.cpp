@@ -79,25 +79,48 @@ std::string TestInfo::errorDebug() const
 
 string TestInfo::makeTestCaseName() const
 {
-    string name;
+    CaseNames const names = currentCase();
+    if (names.suiteName.empty())
+        return names.name;
+    return names.suiteName + "/" + names.name;
+}
+
+TestInfo::CaseNames TestInfo::currentCase()
+{
+    CaseNames const& queued = TestOutputHelper::get().queuedTestCase();
+    if (!queued.name.empty())
+        return queued;
+
+    CaseNames names;
     auto const& boostTCase = framework::current_test_case();
+    names.name = boostTCase.p_name.get();
+    names.fullName = boostTCase.full_name();
     try
     {
         auto const& boostSuite = framework::get<test_suite>(boostTCase.p_parent_id);
-        name = boostSuite.p_name.get() + "/";
+        names.suiteName = boostSuite.p_name.get();
     }
     catch (std::exception const&)
     {
         ETH_WARNING("Error getting parent suite from boost!" + boostTCase.p_name.get());
     }
-
-    return name + boostTCase.p_name.get();
+    return names;
 }
 
-
 std::string TestInfo::caseName()
 {
+    CaseNames const& queued = TestOutputHelper::get().queuedTestCase();
+    if (!queued.name.empty())
+        return queued.name;
     return boost::unit_test::framework::current_test_case().p_name;
 }
 
+std::string TestInfo::caseFullName()
+{
+    CaseNames const& queued = TestOutputHelper::get().queuedTestCase();
+    if (!queued.name.empty())
+        return queued.fullName;
+    return boost::unit_test::framework::current_test_case().full_name();
+}
+
 }
@@ -13,7 +13,18 @@ struct TestInfo
 
     TestInfo(): m_isStateTransactionInfo(false), m_isBlockchainTestInfo(false) {}
     std::string errorDebug() const;
+
+    // Boost test case of the running test. Tests of --globalqueue run after their test case
+    // has returned, such threads take the names from TestOutputHelper::queuedTestCase
+    struct CaseNames
+    {
+        std::string name;
+        std::string suiteName;
+        std::string fullName;
+    };
+    static CaseNames currentCase();
     static std::string caseName();
+    static std::string caseFullName();
     void setTrDataDebug(std::string const& _data) { m_sTransactionData = _data; }
 
 private:
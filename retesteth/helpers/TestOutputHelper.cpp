@@ -21,9 +21,15 @@
 #include <boost/test/tree/test_case_counter.hpp>
 #include <libdevcore/include.h>
 #include <retesteth/EthChecks.h>
+#include <retesteth/ExitHandler.h>
 #include <retesteth/Options.h>
+#include <retesteth/helpers/CompressedFile.h>
 #include <retesteth/helpers/TestHelper.h>
+#include <retesteth/helpers/TestHistory.h>
 #include <retesteth/helpers/TestOutputHelper.h>
+#include <retesteth/helpers/TraceSpan.h>
+#include <retesteth/session/RPCCache.h>
+#include <retesteth/session/Session.h>
 
 using namespace std;
 using namespace dev;
@@ -43,27 +49,60 @@ static std::map<fs::path, FolderNameSet> finishedTestFoldersMap;
 void checkUnfinishedTestFolders();  // Checkup that all test folders are active during the test run
 
 static int execTotalErrors = 0;
-static std::map<thread::id, TestOutputHelper> helperThreadMap;  // threadID => outputHelper
 mutex g_totalTestsRun;
 mutex g_failedTestsMap;
 mutex g_execTotalErrors;
 static int totalTestsRun = 0;
 static std::map<std::string, std::string> s_failedTestsMap;
+mutex g_testResults;
+static std::map<std::string, TestReport::TestResult> s_testResults;
 
+// Helpers of all threads are kept for the error statistics of the run
+// Helper of a finished thread is reused by the next new thread
 mutex g_helperThreadMapMutex;
+static std::vector<std::unique_ptr<TestOutputHelper>> helperRegistry;
+static std::vector<TestOutputHelper*> releasedHelpers;
+static std::vector<std::string> releasedHelpersErrors;  // not yet printed errors of finished threads
+
+namespace
+{
+struct ThreadHelperSlot
+{
+    TestOutputHelper* helper = nullptr;
+    ~ThreadHelperSlot()
+    {
+        if (helper == nullptr)
+            return;
+        std::lock_guard<std::mutex> lock(g_helperThreadMapMutex);
+        releasedHelpers.emplace_back(helper);
+    }
+};
+}  // namespace
+
 TestOutputHelper& TestOutputHelper::get()
 {
-    std::lock_guard<std::mutex> lock(g_helperThreadMapMutex);
-    thread::id const tID = getThreadID();
-    if (helperThreadMap.count(tID))
-        return helperThreadMap.at(tID);
-    else
+    thread_local ThreadHelperSlot slot;
+    if (slot.helper == nullptr)
     {
-        TestOutputHelper instance;
-        helperThreadMap.emplace(std::make_pair(tID, std::move(instance)));
-        helperThreadMap.at(tID).initTest(0);
+        {
+            std::lock_guard<std::mutex> lock(g_helperThreadMapMutex);
+            if (releasedHelpers.size())
+            {
+                slot.helper = releasedHelpers.back();
+                releasedHelpers.pop_back();
+                for (auto const& err : slot.helper->getErrors())
+                    releasedHelpersErrors.emplace_back(err);
+                slot.helper->resetErrors();
+            }
+            else
+            {
+                helperRegistry.emplace_back(new TestOutputHelper());
+                slot.helper = helperRegistry.back().get();
+            }
+        }
+        slot.helper->initTest(0);
     }
-    return helperThreadMap.at(tID);
+    return *slot.helper;
 }
 
 bool TestOutputHelper::markError(std::string const& _message)
@@ -108,7 +147,10 @@ bool TestOutputHelper::markError(std::string const& _message)
 
     // Mark the error
     string const testDebugInfo = m_testInfo.errorDebug();
-    m_errors.emplace_back(_message + testDebugInfo);
+    {
+        std::lock_guard<std::mutex> lock(m_errorsMutex);
+        m_errors.emplace_back(_message + testDebugInfo);
+    }
     if (testDebugInfo.empty())
         ETH_WARNING(TestOutputHelper::get().testName() + ", Message: " + _message +
                     ", has empty debugInfo! Missing debug Testinfo for test step.");
@@ -122,14 +164,36 @@ bool TestOutputHelper::markError(std::string const& _message)
 // retesteth side
 void TestOutputHelper::unmarkLastError()
 {
-    if (m_errors.size())
-        m_errors.pop_back();
+    {
+        std::lock_guard<std::mutex> lock(m_errorsMutex);
+        if (m_errors.size())
+            m_errors.pop_back();
+    }
     std::lock_guard<std::mutex> lock(g_failedTestsMap);
     string const& tname = TestOutputHelper::get().testName();
     if (s_failedTestsMap.count(tname))
         s_failedTestsMap.erase(tname);
 }
 
+std::vector<std::string> TestOutputHelper::getErrors() const
+{
+    std::lock_guard<std::mutex> lock(m_errorsMutex);
+    return m_errors;
+}
+
+void TestOutputHelper::resetErrors()
+{
+    std::lock_guard<std::mutex> lock(m_errorsMutex);
+    m_errors.clear();
+}
+
+void TestOutputHelper::addErrors(std::vector<std::string> const& _errors)
+{
+    std::lock_guard<std::mutex> lock(m_errorsMutex);
+    for (auto const& err : _errors)
+        m_errors.emplace_back(err);
+}
+
 void TestOutputHelper::setUnitTestExceptions(std::vector<std::string> const& _messages)
 {
     m_expected_UnitTestExceptions = _messages;
@@ -153,6 +217,7 @@ void TestOutputHelper::initTest(size_t _maxTests)
     //_maxTests = 0 means this function is called from testing thread
     m_currentTestName = string();
     m_currentTestFileName = string();
+    m_queuedTestCase = TestInfo::CaseNames();
     m_timer = TestOutputTimer();
     TestOutputTimer::resetT8NTime();
     if (_maxTests != 0 && !Options::get().singleTestFile.initialized())
@@ -169,12 +234,81 @@ void TestOutputHelper::initTest(size_t _maxTests)
     m_expected_UnitTestExceptions.clear();
 }
 
+void TestOutputHelper::initQueue(size_t _maxTests)
+{
+    m_queuedTestCase = TestInfo::CaseNames{"GlobalQueue", string(), "GlobalQueue"};
+    m_timer = TestOutputTimer();
+    m_maxTests = _maxTests;
+    m_currTest = 0;
+}
+
 void TestOutputHelper::registerTestRunSuccess()
 {
     std::lock_guard<std::mutex> lock(g_totalTestsRun);
     totalTestsRun++;
 }
 
+void TestOutputHelper::registerTestResult(string const& _test, double _time, bool _failed)
+{
+    std::lock_guard<std::mutex> lock(g_testResults);
+    TestReport::TestResult& result = s_testResults[_test];
+    result.time += _time;
+    result.failed = result.failed || _failed;
+}
+
+TestReport TestOutputHelper::makeTestReport()
+{
+    auto const& opt = Options::get();
+    TestReport report;
+    if (opt.shard.initialized())
+        report.shard = opt.shard.str();
+    {
+        std::lock_guard<std::mutex> lock(g_totalTestsRun);
+        report.testsRun = totalTestsRun;
+    }
+    {
+        std::lock_guard<std::mutex> lock(g_execTotalErrors);
+        report.errors = execTotalErrors;
+    }
+    {
+        std::lock_guard<std::mutex> lock(g_failedTestsMap);
+        report.failedTests = s_failedTestsMap;
+    }
+    {
+        std::lock_guard<std::mutex> lock(g_testResults);
+        report.tests = s_testResults;
+    }
+    for (auto const& el : TestOutputTimer::execTimes())
+    {
+        TestReport::SuiteTime& time = report.suiteTimes[std::get<0>(el)];
+        time.time += std::get<1>(el);
+        time.cputime += std::get<2>(el);
+        time.t8ntime += std::get<3>(el);
+    }
+    return report;
+}
+
+void TestOutputHelper::addTestReport(TestReport const& _report)
+{
+    {
+        std::lock_guard<std::mutex> lock(g_totalTestsRun);
+        totalTestsRun += _report.testsRun;
+    }
+    {
+        std::lock_guard<std::mutex> lock(g_execTotalErrors);
+        execTotalErrors += _report.errors;
+    }
+    {
+        std::lock_guard<std::mutex> lock(g_failedTestsMap);
+        for (auto const& el : _report.failedTests)
+            s_failedTestsMap.emplace(el.first, el.second);
+    }
+    for (auto const& el : _report.tests)
+        registerTestResult(el.first, el.second.time, el.second.failed);
+    for (auto const& el : _report.suiteTimes)
+        TestOutputTimer::addExecTime({el.first, el.second.time, el.second.cputime, el.second.t8ntime});
+}
+
 void TestOutputHelper::showProgress()
 {
     m_currTest++;
@@ -191,7 +325,7 @@ void TestOutputHelper::showProgress()
     }
 }
 
-void TestOutputHelper::finishTest()
+size_t TestOutputHelper::finishTest(bool _boostError)
 {
     auto const& opt = Options::get();
     if (opt.exectimelog && !opt.singleTestFile.initialized())
@@ -199,30 +333,35 @@ void TestOutputHelper::finishTest()
         std::cout << "Tests finished: " << m_currTest << std::endl;
         m_timer.printFinishTest(TestInfo::caseName());
     }
-    printBoostError();  // !! could delete instance of TestOutputHelper !!
+    return printBoostError(_boostError);  // !! could delete instance of TestOutputHelper !!
 }
 
-void TestOutputHelper::printBoostError()
+size_t TestOutputHelper::printBoostError(bool _boostError)
 {
     size_t errorCount = 0;
     std::lock_guard<std::mutex> lock(g_helperThreadMapMutex);
-    for (auto& test : helperThreadMap)
+    for (auto const& err : releasedHelpersErrors)
+        ETH_STDERROR_MESSAGE("Error: " + err);
+    errorCount += releasedHelpersErrors.size();
+    releasedHelpersErrors.clear();
+    for (auto& helper : helperRegistry)
     {
-        TestOutputHelper& threadLocalHelper = test.second;
-        errorCount += threadLocalHelper.getErrors().size();
-        for (auto const& err : threadLocalHelper.getErrors())
+        std::lock_guard<std::mutex> helperLock(helper->m_errorsMutex);
+        errorCount += helper->m_errors.size();
+        for (auto const& err : helper->m_errors)
             ETH_STDERROR_MESSAGE("Error: " + err);
-        threadLocalHelper.resetErrors();
+        helper->m_errors.clear();
     }
     if (errorCount)
     {
         ETH_STDERROR_MESSAGE("\n--------");
         ETH_STDERROR_MESSAGE("TestOutputHelper detected " + fto_string(errorCount) + " errors during test execution!");
         std::lock_guard<std::mutex> lock(g_execTotalErrors);
-        BOOST_ERROR("");  // NOT THREAD SAFE !!!
+        if (_boostError)
+            BOOST_ERROR("");  // NOT THREAD SAFE !!!
         execTotalErrors += errorCount;
     }
-    // helperThreadMap.clear(); !!! could not delete TestHelper from TestHelper destructor !!!
+    return errorCount;
 }
 
 void TestOutputHelper::printTestExecStats()
@@ -231,6 +370,42 @@ void TestOutputHelper::printTestExecStats()
     if (!opt.singleTestFile.initialized())
         checkUnfinishedTestFolders();
 
+    string reportFile = opt.testReport;
+    if (reportFile.empty() && opt.shard.initialized())
+        reportFile = "retesteth-shard-" + fto_string(opt.shard.index) + "-of-" + fto_string(opt.shard.count) + ".json";
+    TestReport const report = makeTestReport();
+    if (!reportFile.empty())
+    {
+        try
+        {
+            report.write(reportFile);
+            ETH_STDOUT_MESSAGE("Test report written to: " + reportFile);
+        }
+        catch (std::exception const& _ex)
+        {
+            ETH_STDERROR_MESSAGE(string("Could not write test report: ") + _ex.what());
+        }
+    }
+    // Times of an interrupted run are cut short, they would spoil the history
+    // Merged shard reports hold times of other runs that were already saved on their machines
+    if (!report.tests.empty() && !ExitHandler::receivedExitSignal() && !opt.mergeReports.initialized())
+    {
+        TestHistory::get().update(report.tests);
+        TestHistory::get().save();
+    }
+    if (opt.traceFile.initialized())
+    {
+        try
+        {
+            size_t const spans = TraceSpan::writeTrace(string(opt.traceFile));
+            ETH_STDOUT_MESSAGE("Trace of " + fto_string(spans) + " spans written to: " + string(opt.traceFile));
+        }
+        catch (std::exception const& _ex)
+        {
+            ETH_STDERROR_MESSAGE(string("Could not write trace file: ") + _ex.what());
+        }
+    }
+
     {
         std::lock_guard<std::mutex> lock(g_totalTestsRun);
         const string message = "*** Total Tests Run: " + fto_string(totalTestsRun) + "\n";
@@ -241,7 +416,11 @@ void TestOutputHelper::printTestExecStats()
     }
 
     if (Options::get().exectimelog)
+    {
         TestOutputTimer::printTotalTimes();
+        session::RPCCache::printStats();
+        session::RPCSession::printStats();
+    }
 
     bool wereExecErrors = false;
     {
@@ -280,12 +459,11 @@ bool pathHasTests(fs::path const& _path)
     for (fsIterator it(_path); it != fsIterator(); ++it)
     {
         // if the extention of a test file
-        if (fs::is_regular_file(it->path()) &&
-            (it->path().extension() == ".json" || it->path().extension() == ".yml"
-                || it->path().extension() == ".py"))
+        auto const extension = withoutCompression(it->path()).extension();
+        if (fs::is_regular_file(it->path()) && (extension == ".json" || extension == ".yml" || extension == ".py"))
         {
             // if the filename ends with Filler/Copier type
-            std::string const name = it->path().stem().filename().string();
+            std::string const name = testFileStem(it->path());
             std::string const suffix =
                 (name.length() > 7) ? name.substr(name.length() - 6) : string();
             if (suffix == "Filler" || suffix == "Copier")
@@ -24,6 +24,8 @@
 #include <boost/test/unit_test.hpp>
 #include <retesteth/helpers/TestInfo.h>
 #include <retesteth/helpers/TestOutputTimer.h>
+#include <retesteth/helpers/TestReport.h>
+#include <mutex>
 #include <thread>
 #include <vector>
 
@@ -34,15 +36,18 @@ class TestOutputHelper
 {
 public:
     static TestOutputHelper& get();
-    TestOutputHelper(TestOutputHelper const&) = default;
+    TestOutputHelper(TestOutputHelper const&) = delete;
     void operator=(TestOutputHelper const&) = delete;
 
     void initTest(size_t _maxTests = 1);
+    // Same for the --globalqueue tests, which run after the last boost test case
+    void initQueue(size_t _maxTests);
 
     // Display percantage of completed tests to std::out.
     // Has to be called before execution of every test.
     void showProgress();
-    void finishTest();
+    // Returns the number of errors, _boostError reports them to the current boost test case
+    size_t finishTest(bool _boostError = true);
     TestOutputTimer& timer() { return m_timer; }
 
     bool markError(std::string const& _message);
@@ -57,16 +62,20 @@ public:
         return m_expected_UnitTestExceptions;
     }
 
-    std::vector<std::string> const& getErrors() const { return m_errors;}
-    void resetErrors() { m_errors.clear(); }
+    std::vector<std::string> getErrors() const;
+    void resetErrors();
+    void addErrors(std::vector<std::string> const& _errors);  // errors of the sub task threads of this test
     void setCurrentTestFile(boost::filesystem::path const& _name) { m_currentTestFileName = _name; }
     void setCurrentTestName(std::string const& _name) { m_currentTestName = _name; }
     void setCurrentTestInfo(TestInfo const& _info) { m_testInfo = _info; }
     TestInfo const& testInfo() const { return m_testInfo; }
+    void setQueuedTestCase(TestInfo::CaseNames const& _case) { m_queuedTestCase = _case; }
+    TestInfo::CaseNames const& queuedTestCase() const { return m_queuedTestCase; }
     std::string const& testName() const { return m_currentTestName; }
     boost::filesystem::path const& testFile() const { return m_currentTestFileName; }
     static void printTestExecStats();
     static void registerTestRunSuccess();
+    static void registerTestResult(std::string const& _test, double _time, bool _failed);
     static void currentTestRunPP() { m_currentTestRun++; };
 
     /// get string representation of current threadID
@@ -76,13 +85,17 @@ public:
     static void addTestVector(std::string&& _str);
     static void printTestVectors();
 
+    // Results of the run for --report, and adding results of other runs for --merge-reports
+    static TestReport makeTestReport();
+    static void addTestReport(TestReport const& _report);
+
     // Mark the _folderName as executed for a given _suitePath (to filler files)
     static void markTestFolderAsFinished(
         boost::filesystem::path const& _suitePath, std::string const& _folderName);
 
 private:
     TestOutputHelper() {}
-    void printBoostError();
+    size_t printBoostError(bool _boostError = true);
 
 private:
     TestOutputTimer m_timer;
@@ -90,8 +103,10 @@ private:
     size_t m_maxTests;
     std::string m_currentTestName;
     TestInfo m_testInfo;
+    TestInfo::CaseNames m_queuedTestCase;
     boost::filesystem::path m_currentTestFileName;
     std::vector<std::string> m_errors; //flag errors for triggering boost erros after all thread finished
+    mutable std::mutex m_errorsMutex;   // errors are printed from another thread
     std::vector<std::string> m_expected_UnitTestExceptions;  // expect following errors
 
     // Debug print
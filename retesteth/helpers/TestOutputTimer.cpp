@@ -3,8 +3,7 @@
 using namespace std;
 
 namespace  {
-    // test, time, cputime, t8ntime
-    typedef std::tuple<string, double, double, double> execTimeName;
+    typedef test::TestOutputTimer::ExecTime execTimeName;
 
     std::mutex g_execTimeResults;
     static std::vector<execTimeName> execTimeResults;
@@ -66,6 +65,18 @@ void TestOutputTimer::printFinishTest(string const& _testName) const
     execTimeResults.emplace_back(res);
 }
 
+std::vector<TestOutputTimer::ExecTime> TestOutputTimer::execTimes()
+{
+    std::lock_guard<std::mutex> lock(g_execTimeResults);
+    return execTimeResults;
+}
+
+void TestOutputTimer::addExecTime(ExecTime const& _time)
+{
+    std::lock_guard<std::mutex> lock(g_execTimeResults);
+    execTimeResults.emplace_back(_time);
+}
+
 string makeTimePercent(double _time, double _totalTime)
 {
     std::ostringstream out;
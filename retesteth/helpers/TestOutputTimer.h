@@ -1,11 +1,17 @@
 #pragma once
 #include <libdevcore/Common.h>
+#include <string>
+#include <tuple>
+#include <vector>
 
 namespace test {
 
 class TestOutputTimer
 {
 public:
+    // test, time, cputime, t8ntime
+    typedef std::tuple<std::string, double, double, double> ExecTime;
+
     TestOutputTimer();
     void restart();
     void startSubcallTimer();
@@ -13,6 +19,8 @@ public:
     void printFinishTest(std::string const&) const;
     static void printTotalTimes();
     static void resetT8NTime();
+    static std::vector<ExecTime> execTimes();
+    static void addExecTime(ExecTime const& _time);
 private:
     double getTotalTimer() const { return m_timerTotal.elapsed(); }
     double getTotalCPU() const { return m_timerCPU.elapsed(); }
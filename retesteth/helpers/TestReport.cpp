@@ -0,0 +1,217 @@
+#include "TestReport.h"
+#include <libdataobj/ConvertFile.h>
+#include <libdevcore/CommonIO.h>
+#include <cmath>
+#include <cstdio>
+#include <stdexcept>
+
+using namespace std;
+using namespace dataobject;
+namespace fs = boost::filesystem;
+
+namespace
+{
+string const c_shard = "shard";
+string const c_testsRun = "testsRun";
+string const c_errors = "errors";
+string const c_failedTests = "failedTests";
+string const c_tests = "tests";
+string const c_suiteTimes = "suiteTimes";
+string const c_timeMs = "timeMs";
+string const c_cputimeMs = "cputimeMs";
+string const c_t8ntimeMs = "t8ntimeMs";
+string const c_failed = "failed";
+
+// DataObject keeps integers, times are stored in milliseconds
+int toMs(double _seconds)
+{
+    return int(std::lround(_seconds * 1000));
+}
+
+double fromMs(DataObject const& _obj, string const& _key)
+{
+    return _obj.count(_key) ? _obj.atKey(_key).asInt() / 1000.0 : 0;
+}
+
+// DataObject keeps strings as they are written in json, debug info could have any chars
+// A backslash is written as \u005c, the json parser would take `\\"` for an escaped quote
+string escapeString(string const& _str)
+{
+    string res;
+    res.reserve(_str.size());
+    for (unsigned char const ch : _str)
+    {
+        switch (ch)
+        {
+        case '"': res += "\\\""; break;
+        case '\\': res += "\\u005c"; break;
+        case '\n': res += "\\n"; break;
+        case '\t': res += "\\t"; break;
+        case '\r': res += "\\r"; break;
+        default:
+            if (ch < 0x20)
+            {
+                char code[7];
+                std::snprintf(code, sizeof(code), "\\u%04x", ch);
+                res += code;
+            }
+            else
+                res += char(ch);
+        }
+    }
+    return res;
+}
+
+string unescapeString(string const& _str)
+{
+    string res;
+    res.reserve(_str.size());
+    for (size_t i = 0; i < _str.size(); i++)
+    {
+        if (_str.at(i) != '\\' || i + 1 == _str.size())
+        {
+            res += _str.at(i);
+            continue;
+        }
+        char const ch = _str.at(++i);
+        switch (ch)
+        {
+        case 'n': res += '\n'; break;
+        case 't': res += '\t'; break;
+        case 'r': res += '\r'; break;
+        case 'b': res += '\b'; break;
+        case 'f': res += '\f'; break;
+        case 'u':
+        {
+            if (i + 4 >= _str.size())
+                throw std::runtime_error("test report string has a broken escape: " + _str);
+            unsigned long const code = std::stoul(_str.substr(i + 1, 4), nullptr, 16);
+            i += 4;
+            if (code < 0x80)
+                res += char(code);
+            else if (code < 0x800)
+            {
+                res += char(0xC0 | (code >> 6));
+                res += char(0x80 | (code & 0x3F));
+            }
+            else
+            {
+                res += char(0xE0 | (code >> 12));
+                res += char(0x80 | ((code >> 6) & 0x3F));
+                res += char(0x80 | (code & 0x3F));
+            }
+            break;
+        }
+        default: res += ch;  // `"`, `\` and `/`
+        }
+    }
+    return res;
+}
+
+DataObject const& requireField(DataObject const& _data, string const& _key, DataType _type)
+{
+    if (!_data.count(_key) || _data.atKey(_key).type() != _type)
+        throw std::runtime_error("test report field `" + _key + "` is missing or has wrong type");
+    return _data.atKey(_key);
+}
+}  // namespace
+
+namespace test
+{
+void TestReport::merge(TestReport const& _report)
+{
+    testsRun += _report.testsRun;
+    errors += _report.errors;
+    for (auto const& el : _report.failedTests)
+        failedTests.emplace(el.first, el.second);
+    for (auto const& el : _report.tests)
+    {
+        TestResult& result = tests[el.first];
+        result.time += el.second.time;
+        result.failed = result.failed || el.second.failed;
+    }
+    for (auto const& el : _report.suiteTimes)
+    {
+        SuiteTime& time = suiteTimes[el.first];
+        time.time += el.second.time;
+        time.cputime += el.second.cputime;
+        time.t8ntime += el.second.t8ntime;
+    }
+}
+
+spDataObject TestReport::asData() const
+{
+    spDataObject data(new DataObject(DataType::Object));
+    if (!shard.empty())
+        (*data)[c_shard] = shard;
+    (*data)[c_testsRun] = int(testsRun);
+    (*data)[c_errors] = int(errors);
+
+    spDataObject failed(new DataObject(DataType::Object));
+    for (auto const& el : failedTests)
+        (*failed)[escapeString(el.first)] = escapeString(el.second);
+    (*data).addSubObject(c_failedTests, failed);
+
+    spDataObject testResults(new DataObject(DataType::Object));
+    for (auto const& el : tests)
+    {
+        spDataObject result(new DataObject(DataType::Object));
+        (*result)[c_timeMs] = toMs(el.second.time);
+        (*result).addSubObject(c_failed, spDataObject(new DataObject(DataType::Bool, el.second.failed)));
+        (*testResults).addSubObject(el.first, result);
+    }
+    (*data).addSubObject(c_tests, testResults);
+
+    spDataObject times(new DataObject(DataType::Object));
+    for (auto const& el : suiteTimes)
+    {
+        spDataObject time(new DataObject(DataType::Object));
+        (*time)[c_timeMs] = toMs(el.second.time);
+        (*time)[c_cputimeMs] = toMs(el.second.cputime);
+        (*time)[c_t8ntimeMs] = toMs(el.second.t8ntime);
+        (*times).addSubObject(el.first, time);
+    }
+    (*data).addSubObject(c_suiteTimes, times);
+    return data;
+}
+
+TestReport TestReport::fromData(DataObject const& _data)
+{
+    TestReport report;
+    if (_data.count(c_shard))
+        report.shard = _data.atKey(c_shard).asString();
+    report.testsRun = requireField(_data, c_testsRun, DataType::Integer).asInt();
+    report.errors = requireField(_data, c_errors, DataType::Integer).asInt();
+    for (auto const& el : requireField(_data, c_failedTests, DataType::Object).getSubObjects())
+        report.failedTests.emplace(unescapeString(el->getKey()), unescapeString(el->asString()));
+    for (auto const& el : requireField(_data, c_tests, DataType::Object).getSubObjects())
+    {
+        TestResult& result = report.tests[el->getKey()];
+        result.time = fromMs(el.getCContent(), c_timeMs);
+        result.failed = el->count(c_failed) && el->atKey(c_failed).asBool();
+    }
+    for (auto const& el : requireField(_data, c_suiteTimes, DataType::Object).getSubObjects())
+    {
+        SuiteTime& time = report.suiteTimes[el->getKey()];
+        time.time = fromMs(el.getCContent(), c_timeMs);
+        time.cputime = fromMs(el.getCContent(), c_cputimeMs);
+        time.t8ntime = fromMs(el.getCContent(), c_t8ntimeMs);
+    }
+    return report;
+}
+
+TestReport TestReport::read(fs::path const& _file)
+{
+    string const content = dev::contentsString(_file);
+    if (content.empty())
+        throw std::runtime_error("could not read test report " + _file.string());
+    return fromData(ConvertJsoncppStringToData(content));
+}
+
+void TestReport::write(fs::path const& _file) const
+{
+    string const json = asData()->asJson();
+    dev::writeFile(_file, dev::bytesConstRef(json), true);
+}
+
+}  // namespace test
@@ -0,0 +1,40 @@
+#pragma once
+#include <libdataobj/DataObject.h>
+#include <boost/filesystem/path.hpp>
+#include <map>
+#include <string>
+
+namespace test
+{
+/// Machine readable results of a run, written by every --shard and combined with --merge-reports
+struct TestReport
+{
+    struct TestResult
+    {
+        double time = 0;  // seconds
+        bool failed = false;
+    };
+    struct SuiteTime
+    {
+        double time = 0;
+        double cputime = 0;
+        double t8ntime = 0;
+    };
+
+    std::string shard;  // "i/N" if the run was a shard
+    size_t testsRun = 0;
+    size_t errors = 0;
+    std::map<std::string, std::string> failedTests;  // test name => error debug info
+    std::map<std::string, TestResult> tests;         // suite/folder/test => filler execution result
+    std::map<std::string, SuiteTime> suiteTimes;     // test case => --exectimelog times
+
+    void merge(TestReport const& _report);
+    dataobject::spDataObject asData() const;
+    static TestReport fromData(dataobject::DataObject const& _data);
+
+    /// Throws on a malformed report file
+    static TestReport read(boost::filesystem::path const& _file);
+    void write(boost::filesystem::path const& _file) const;
+};
+
+}  // namespace test
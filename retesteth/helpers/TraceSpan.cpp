@@ -0,0 +1,128 @@
+#include "TraceSpan.h"
+#include <libdevcore/CommonIO.h>
+#include <retesteth/Options.h>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <vector>
+
+using namespace std;
+namespace fs = boost::filesystem;
+
+namespace
+{
+size_t const c_ringSize = 1 << 16;
+
+struct Span
+{
+    char const* name;
+    uint64_t start;
+    uint64_t duration;
+};
+
+// Spans of one thread, the oldest are overwritten when the ring is full
+// A buffer of a finished thread is reused by the next new thread and shows as the same trace lane
+struct SpanRing
+{
+    size_t lane = 0;
+    std::mutex mutex;  // not contended, only the trace writer locks it from another thread
+    vector<Span> spans;
+    size_t recorded = 0;
+};
+
+std::mutex g_ringsMutex;
+vector<unique_ptr<SpanRing>> g_rings;
+vector<SpanRing*> g_releasedRings;
+
+struct ThreadRingSlot
+{
+    SpanRing* ring = nullptr;
+    ~ThreadRingSlot()
+    {
+        if (ring == nullptr)
+            return;
+        std::lock_guard<std::mutex> lock(g_ringsMutex);
+        g_releasedRings.emplace_back(ring);
+    }
+};
+
+SpanRing& threadRing()
+{
+    thread_local ThreadRingSlot slot;
+    if (slot.ring == nullptr)
+    {
+        std::lock_guard<std::mutex> lock(g_ringsMutex);
+        if (g_releasedRings.size())
+        {
+            slot.ring = g_releasedRings.back();
+            g_releasedRings.pop_back();
+        }
+        else
+        {
+            g_rings.emplace_back(new SpanRing());
+            g_rings.back()->lane = g_rings.size();
+            slot.ring = g_rings.back().get();
+        }
+    }
+    return *slot.ring;
+}
+
+std::chrono::steady_clock::time_point const c_traceStart = std::chrono::steady_clock::now();
+}  // namespace
+
+namespace test
+{
+std::atomic<int> TraceSpan::s_state = -1;
+
+bool TraceSpan::initState()
+{
+    bool const enabled = Options::get().traceFile.initialized();
+    setEnabled(enabled);
+    return enabled;
+}
+
+uint64_t TraceSpan::now()
+{
+    auto const elapsed = std::chrono::steady_clock::now() - c_traceStart;
+    return std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count() + 1;
+}
+
+void TraceSpan::record(char const* _name, uint64_t _start, uint64_t _end)
+{
+    SpanRing& ring = threadRing();
+    std::lock_guard<std::mutex> lock(ring.mutex);
+    Span const span = {_name, _start, _end - _start};
+    if (ring.spans.size() < c_ringSize)
+        ring.spans.emplace_back(span);
+    else
+        ring.spans.at(ring.recorded % c_ringSize) = span;
+    ring.recorded++;
+}
+
+size_t TraceSpan::writeTrace(fs::path const& _file)
+{
+    std::ostringstream out;
+    out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+    size_t written = 0;
+    std::lock_guard<std::mutex> lock(g_ringsMutex);
+    for (auto const& ring : g_rings)
+    {
+        std::lock_guard<std::mutex> ringLock(ring->mutex);
+        out << (written++ ? ",\n" : "\n");
+        out << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << ring->lane
+            << ",\"args\":{\"name\":\"thread " << ring->lane << "\"}}";
+        for (auto const& span : ring->spans)
+        {
+            out << ",\n{\"name\":\"" << span.name << "\",\"ph\":\"X\",\"pid\":1,\"tid\":" << ring->lane
+                << ",\"ts\":" << span.start << ",\"dur\":" << span.duration << "}";
+            written++;
+        }
+    }
+    out << "\n]}\n";
+    string const json = out.str();
+    dev::writeFile(_file, dev::bytesConstRef(json), true);
+    return written - g_rings.size();
+}
+
+}  // namespace test
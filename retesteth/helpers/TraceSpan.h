@@ -0,0 +1,48 @@
+#pragma once
+#include <boost/filesystem/path.hpp>
+#include <atomic>
+#include <cstdint>
+
+namespace test
+{
+// Scoped span of a test execution phase for --tracefile
+// Spans are kept in a ring buffer of each thread and written in chrome://tracing (Perfetto) json format
+// Without --tracefile a span costs one relaxed atomic load
+class TraceSpan
+{
+public:
+    // _name must be a string literal, it is kept until the trace is written
+    TraceSpan(char const* _name) : m_name(_name), m_start(enabled() ? now() : 0) {}
+    ~TraceSpan()
+    {
+        if (m_start != 0)
+            record(m_name, m_start, now());
+    }
+    TraceSpan(TraceSpan const&) = delete;
+    TraceSpan& operator=(TraceSpan const&) = delete;
+
+    static bool enabled()
+    {
+        int const state = s_state.load(std::memory_order_relaxed);
+        return state < 0 ? initState() : state == 1;
+    }
+    static void setEnabled(bool _enabled) { s_state.store(_enabled ? 1 : 0, std::memory_order_relaxed); }
+
+    // Write spans of all threads, returns the number of written spans
+    static size_t writeTrace(boost::filesystem::path const& _file);
+
+private:
+    static bool initState();
+    static uint64_t now();  // microseconds, never 0
+    static void record(char const* _name, uint64_t _start, uint64_t _end);
+
+    char const* m_name;
+    uint64_t m_start;
+    static std::atomic<int> s_state;  // -1 unknown, 0 disabled, 1 enabled
+};
+
+}  // namespace test
+
+#define ETH_TRACE_CONCAT2(A, B) A##B
+#define ETH_TRACE_CONCAT(A, B) ETH_TRACE_CONCAT2(A, B)
+#define ETH_TRACE_SPAN(NAME) test::TraceSpan const ETH_TRACE_CONCAT(traceSpan, __LINE__)(NAME)
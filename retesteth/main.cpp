@@ -1,5 +1,6 @@
 #define BOOST_TEST_MODULE EthereumTests
 #define BOOST_TEST_NO_MAIN
+#include <Options.h>
 #include <mainHelper.h>
 #include <retesteth/EthChecks.h>
 #include <retesteth/ExitHandler.h>
@@ -42,6 +43,8 @@ int main(int argc, const char* argv[])
 
     auto argv2 = preprocessOptions(argc, argv);
     initializeOptions(argc, argv2);
+    if (test::Options::get().mergeReports.initialized())
+        return mergeTestReports();
     expandUnitTestsArg(argc, argv2);
     makeSingleTestFileSuite(argc, argv2);
 
@@ -4,6 +4,7 @@
 #include <Options.h>
 #include <retesteth/helpers/TestHelper.h>
 #include <retesteth/helpers/TestOutputHelper.h>
+#include <retesteth/testSuiteRunner/TestQueue.h>
 #include <mainHelper.h>
 #include <iostream>
 #include <sstream>
@@ -16,6 +17,7 @@
 
 #include <libdataobj/ConvertFile.h>
 #include <libdevcore/CommonIO.h>
+#include <boost/cstdlib.hpp>
 #include <boost/filesystem.hpp>
 
 using namespace std;
@@ -123,7 +125,7 @@ void expandUnitTestsArg(int _argc, const char* _argv[])
         {
             _argv[i + 1] =
                 "LLLCSuite,SOLCSuite,DataObjectTestSuite,EthObjectsSuite,OptionsSuite,TestHelperSuite,ExpectSectionSuite,"
-                "trDataCompileSuite,StructTest,MemoryLeak,TestSuites";
+                "trDataCompileSuite,StructTest,MemoryLeak,TestSuites,SessionSuite,CompileCacheSuite,TestFileCacheSuite,CompressionSuite,TestShardSuite,TestHistorySuite,TestQueueSuite,TraceSuite";
             break;
         }
     }
@@ -263,6 +265,13 @@ int runTheBoostTests(int _argc, const char* _argv[])
         ETH_DC_MESSAGE(DC::STATS, string("Running tests using path: ") + testPath.c_str());
 
         auto fakeInit = [](int, char* []) -> boost::unit_test::test_suite* { return nullptr; };
+        auto runTests = [fakeInit](int _argc, char** _argv) {
+            int res = unit_test_main(fakeInit, _argc, _argv);
+            // With --globalqueue test cases only list their tests
+            if (test::testsuite::TestQueue::run() != 0 && res == boost::exit_success)
+                res = boost::exit_test_failure;
+            return res;
+        };
         if (opt.vmtrace || !opt.travisOutThread || opt.getvectors)
         {
             if (opt.getvectors)
@@ -271,7 +280,7 @@ int runTheBoostTests(int _argc, const char* _argv[])
             std::atomic_bool stopTimeout{false};
             std::thread timeout(timeoutThread, &stopTimeout);
             // Do not use travis '.' output thread if debug is defined
-            result = unit_test_main(fakeInit, _argc, const_cast<char**>(_argv));
+            result = runTests(_argc, const_cast<char**>(_argv));
             stopTimeout = true;
             timeout.join();
 
@@ -287,7 +296,7 @@ int runTheBoostTests(int _argc, const char* _argv[])
             // Initialize travis '.' output thread for log activity
             std::atomic_bool stopTravisOut{false};
             std::thread outputThread(travisOut, &stopTravisOut);
-            result = unit_test_main(fakeInit, _argc, const_cast<char**>(_argv));
+            result = runTests(_argc, const_cast<char**>(_argv));
             stopTravisOut = true;
             outputThread.join();
         }
@@ -299,6 +308,61 @@ int runTheBoostTests(int _argc, const char* _argv[])
     return result;
 }
 
+int mergeTestReports()
+{
+    test::Options const& opt = test::Options::get();
+    vector<fs::path> reportFiles;
+    for (auto const& path : std::vector<string>(opt.mergeReports))
+    {
+        if (fs::is_directory(path))
+        {
+            for (fs::directory_iterator it(path); it != fs::directory_iterator(); ++it)
+                if (fs::is_regular_file(it->path()) && it->path().extension() == ".json")
+                    reportFiles.emplace_back(it->path());
+        }
+        else
+            reportFiles.emplace_back(path);
+    }
+    std::sort(reportFiles.begin(), reportFiles.end());
+
+    if (reportFiles.empty())
+    {
+        ETH_STDERROR_MESSAGE("Error: no test reports found to merge");
+        return 1;
+    }
+
+    // --report writes the merged result in printTestExecStats
+    size_t errors = 0;
+    set<string> shards;
+    size_t shardCount = 0;
+    for (auto const& file : reportFiles)
+    {
+        test::TestReport report;
+        try
+        {
+            report = test::TestReport::read(file);
+        }
+        catch (std::exception const& _ex)
+        {
+            ETH_STDERROR_MESSAGE("Error: " + file.string() + ": " + _ex.what());
+            return 1;
+        }
+        if (!report.shard.empty())
+        {
+            if (!shards.emplace(report.shard).second)
+                ETH_WARNING("Shard " + report.shard + " is reported twice, " + file.string());
+            shardCount = atoi(report.shard.substr(report.shard.find('/') + 1).c_str());
+        }
+        test::TestOutputHelper::addTestReport(report);
+        errors += report.errors;
+    }
+    if (shardCount != 0 && shards.size() != shardCount)
+        ETH_WARNING("Merged " + test::fto_string(shards.size()) + " of " + test::fto_string(shardCount) + " shard reports!");
+
+    test::TestOutputHelper::printTestExecStats();
+    return errors == 0 ? 0 : 1;
+}
+
 void lookForUnregisteredTestFolders()
 {
     typedef vector<string> vectorString;
@@ -415,7 +479,7 @@ const char** preprocessOptions(int& _argc, const char* _argv[])
     for (short i = 1; i < _argc; i++)
     {
         string const arg = string{_argv[i]};
-        if (arg == "--help" || arg == "--version")
+        if (arg == "--help" || arg == "--version" || arg == "--merge-reports")
             return _argv;
         if (arg == "--testpath" && i + 1 < _argc)
             testPath = fs::path(std::string{_argv[i + 1]});
@@ -440,9 +504,17 @@ const char** preprocessOptions(int& _argc, const char* _argv[])
         if (arg == "-t")
             hasTArg = true;
 
+        // Files of the report options are not tests
+        static set<string> const fileOptions = {"--testfile", "--report", "--shardweights", "--testhistory", "--tracefile"};
+        if (fileOptions.count(string{_argv[i - 1]}))
+        {
+            options.emplace_back(arg);
+            continue;
+        }
+
         bool isFile = (arg.find(".json") != string::npos || arg.find(".yml") != string::npos
                     || arg.find(".py") != string::npos);
-        if (isFile && string{_argv[i - 1]} != "--testfile")
+        if (isFile)
         {
             filenameArg = arg;
             if (!testPath.empty() && fs::relative(cwd, testPath).string().find("..") == string::npos)
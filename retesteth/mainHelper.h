@@ -11,6 +11,7 @@ void expandUnitTestsArg(int _argc, const char* _argv[]);
 void makeSingleTestFileSuite(int _argc, const char* _argv[]);
 bool checkTestSuiteIsKnown(int argc, const char* argv[], std::string sMinusTArg = std::string());
 int runTheBoostTests(int _argc, const char* _argv[]);
+int mergeTestReports();
 
 void lookForUnregisteredTestFolders();
 void cleanMemory();
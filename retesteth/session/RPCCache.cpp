@@ -0,0 +1,125 @@
+#include "RPCCache.h"
+#include <atomic>
+#include <iomanip>
+#include <iostream>
+
+using namespace std;
+using namespace dataobject;
+using namespace test::teststruct;
+
+namespace
+{
+size_t const c_maxCachedBlocks = 256;
+size_t const c_maxCachedAccountFields = 4096;
+
+std::atomic<size_t> g_blockHits{0};
+std::atomic<size_t> g_blockRequests{0};
+std::atomic<size_t> g_accountHits{0};
+std::atomic<size_t> g_accountRequests{0};
+
+string blockKey(string const& _id, bool _fullObjects)
+{
+    return _id + (_fullObjects ? ":f" : ":l");
+}
+
+string printHitRate(size_t _hits, size_t _requests)
+{
+    std::ostringstream out;
+    out << std::fixed << std::setprecision(2);
+    out << _hits << " / " << _requests;
+    out << " (" << (_requests == 0 ? 0.0 : 100.0 * _hits / _requests) << "%)";
+    return out.str();
+}
+}  // namespace
+
+namespace test::session
+{
+RPCCache::RPCCache()
+  : m_blocksByHash(c_maxCachedBlocks), m_blocksByNumber(c_maxCachedBlocks), m_accounts(c_maxCachedAccountFields)
+{}
+
+spEthGetBlockBy RPCCache::getBlockByHash(FH32 const& _hash, bool _fullObjects)
+{
+    g_blockRequests++;
+    BlockRecord const* record = m_blocksByHash.get(blockKey(_hash.asString(), _fullObjects));
+    if (record == nullptr)
+        return spEthGetBlockBy(0);
+    g_blockHits++;
+    return record->block;
+}
+
+spEthGetBlockBy RPCCache::getBlockByNumber(VALUE const& _number, bool _fullObjects)
+{
+    g_blockRequests++;
+    BlockRecord const* record = m_blocksByNumber.get(blockKey(_number.asDecString(), _fullObjects));
+    if (record == nullptr)
+        return spEthGetBlockBy(0);
+    g_blockHits++;
+    return record->block;
+}
+
+void RPCCache::putBlock(spEthGetBlockBy const& _block, bool _fullObjects, bool _byNumber)
+{
+    VALUE const& number = _block->header()->number();
+    BlockRecord const record = {number.asBigInt(), _block};
+
+    // A block requested by hash could be on a side chain, so only index it by number
+    // when it was requested by number
+    m_blocksByHash.put(blockKey(_block->header()->hash().asString(), _fullObjects), record);
+    if (_byNumber)
+        m_blocksByNumber.put(blockKey(number.asDecString(), _fullObjects), record);
+}
+
+spDataObject RPCCache::getAccountField(AccountField _field, FH20 const& _address, VALUE const& _number)
+{
+    g_accountRequests++;
+    string const key = to_string((int)_field) + _address.asString() + _number.asDecString();
+    Record const* record = m_accounts.get(key);
+    if (record == nullptr)
+        return spDataObject(0);
+    g_accountHits++;
+    return record->value->copy();
+}
+
+void RPCCache::putAccountField(AccountField _field, FH20 const& _address, VALUE const& _number, spDataObject const& _value)
+{
+    string const key = to_string((int)_field) + _address.asString() + _number.asDecString();
+    m_accounts.put(key, {_number.asBigInt(), _value->copy()});
+}
+
+void RPCCache::onSetChainParams()
+{
+    m_blocksByHash.clear();
+    m_blocksByNumber.clear();
+    m_accounts.clear();
+}
+
+void RPCCache::onRewindToBlock(VALUE const& _number)
+{
+    dev::bigint const& number = _number.asBigInt();
+    auto const isAbove = [&number](auto const& _record) { return _record.number > number; };
+    m_blocksByHash.eraseIf(isAbove);
+    m_blocksByNumber.eraseIf(isAbove);
+    m_accounts.eraseIf(isAbove);
+}
+
+void RPCCache::onImportRawBlock()
+{
+    // The import might be a competing chain that reorgs the canonical blocks
+    // Blocks by hash remain immutable
+    m_blocksByNumber.clear();
+    m_accounts.clear();
+}
+
+void RPCCache::printStats()
+{
+    if (g_blockRequests == 0 && g_accountRequests == 0)
+        return;
+    std::cout << "*** RPC cache hit rate" << std::endl;
+    std::cout << std::left;
+    std::cout << std::setw(37) << "Blocks: " << printHitRate(g_blockHits, g_blockRequests) << "\n";
+    std::cout << std::setw(37) << "Accounts: " << printHitRate(g_accountHits, g_accountRequests) << "\n";
+    std::cout << "\n";
+}
+
+}  // namespace test::session
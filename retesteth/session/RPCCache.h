@@ -0,0 +1,116 @@
+#pragma once
+#include <retesteth/testStructures/basetypes.h>
+#include <retesteth/testStructures/types/rpc.h>
+#include <list>
+#include <map>
+#include <string>
+
+namespace test::session
+{
+using namespace test::teststruct;
+
+// Least recently used map with a fixed capacity
+template <class T>
+class LRUMap
+{
+public:
+    LRUMap(size_t _capacity) : m_capacity(_capacity) {}
+    T const* get(std::string const& _key)
+    {
+        auto const it = m_index.find(_key);
+        if (it == m_index.end())
+            return nullptr;
+        m_order.splice(m_order.begin(), m_order, it->second);
+        return &it->second->second;
+    }
+    void put(std::string const& _key, T const& _value)
+    {
+        auto const it = m_index.find(_key);
+        if (it != m_index.end())
+        {
+            it->second->second = _value;
+            m_order.splice(m_order.begin(), m_order, it->second);
+            return;
+        }
+        m_order.emplace_front(_key, _value);
+        m_index.emplace(_key, m_order.begin());
+        if (m_order.size() > m_capacity)
+        {
+            m_index.erase(m_order.back().first);
+            m_order.pop_back();
+        }
+    }
+    template <class F>
+    void eraseIf(F const& _predicate)
+    {
+        for (auto it = m_order.begin(); it != m_order.end();)
+        {
+            if (_predicate(it->second))
+            {
+                m_index.erase(it->first);
+                it = m_order.erase(it);
+            }
+            else
+                it++;
+        }
+    }
+    void clear()
+    {
+        m_order.clear();
+        m_index.clear();
+    }
+    size_t size() const { return m_order.size(); }
+
+private:
+    typedef std::pair<std::string, T> Entry;
+    size_t m_capacity;
+    std::list<Entry> m_order;
+    std::map<std::string, typename std::list<Entry>::iterator> m_index;
+};
+
+// Per session cache of parsed RPC responses
+// Blocks requested by hash are immutable. Blocks requested by number and account
+// lookups stay valid until the chain is rewinded, reset or reorganized by an import
+// Blocks are shared with the callers and must not be modified, account fields are returned as copies
+class RPCCache
+{
+public:
+    RPCCache();
+    spEthGetBlockBy getBlockByHash(FH32 const& _hash, bool _fullObjects);
+    spEthGetBlockBy getBlockByNumber(VALUE const& _number, bool _fullObjects);
+    void putBlock(spEthGetBlockBy const& _block, bool _fullObjects, bool _byNumber);
+
+    enum class AccountField
+    {
+        BALANCE,
+        NONCE,
+        CODE
+    };
+    spDataObject getAccountField(AccountField _field, FH20 const& _address, VALUE const& _number);
+    void putAccountField(AccountField _field, FH20 const& _address, VALUE const& _number, spDataObject const& _value);
+
+    // Invalidation
+    void onSetChainParams();
+    void onRewindToBlock(VALUE const& _number);
+    void onImportRawBlock();
+
+    // Statistics of all sessions for --exectimelog
+    static void printStats();
+
+private:
+    struct BlockRecord
+    {
+        dev::bigint number;
+        spEthGetBlockBy block;
+    };
+    struct Record
+    {
+        dev::bigint number;
+        spDataObject value;
+    };
+    LRUMap<BlockRecord> m_blocksByHash;
+    LRUMap<BlockRecord> m_blocksByNumber;
+    LRUMap<Record> m_accounts;
+};
+
+}  // namespace test::session
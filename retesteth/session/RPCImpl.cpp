@@ -4,6 +4,7 @@
 #include <retesteth/Options.h>
 #include <retesteth/helpers/TestHelper.h>
 #include <retesteth/helpers/TestOutputHelper.h>
+#include <retesteth/helpers/TraceSpan.h>
 #include <retesteth/session/RPCImpl.h>
 #include <retesteth/session/Session.h>
 
@@ -11,18 +12,30 @@ using namespace std;
 using namespace test;
 using namespace test::debug;
 
+namespace
+{
+// Client field names in the rpc result are renamed back while parsing the reply
+CJOptions fieldReplaceReplyOpt()
+{
+    CJOptions opt;
+    opt.keyReplace = Options::getCurrentConfig().fieldReplaceMap(FieldReplaceDir::ClientToRetesteth);
+    opt.keyReplaceScope = "result";
+    return opt;
+}
+}  // namespace
+
 namespace test::session
 {
 spDataObject RPCImpl::web3_clientVersion()
 {
-    return rpcCall("web3_clientVersion", {});
+    return rpcSend(m_request.begin("web3_clientVersion"));
 }
 
 // ETH Methods
 FH32 RPCImpl::eth_sendRawTransaction(BYTES const& _rlp, VALUE const& _secret)
 {
     (void)_secret;
-    spDataObject const result = rpcCall("eth_sendRawTransaction", {quote(_rlp.asString())}, true);
+    spDataObject const result = rpcSend(m_request.begin("eth_sendRawTransaction").bytes(_rlp), true);
     if (!m_lastInterfaceError.empty())
     {
         ETH_WARNING("eth_sendRawTransaction:: " + m_lastInterfaceError.message());
@@ -35,8 +48,13 @@ spVALUE RPCImpl::eth_getTransactionCount(FH20 const& _address, VALUE const& _blo
 {
     try
     {
-        spDataObject response = rpcCall("eth_getTransactionCount", {quote(_address.asString()), quote(_blockNumber.asString())});
-        (*response).performModifier(mod_valueToCompactEvenHexPrefixed);
+        spDataObject response = m_cache.getAccountField(RPCCache::AccountField::NONCE, _address, _blockNumber);
+        if (response.isEmpty())
+        {
+            response = rpcSend(m_request.begin("eth_getTransactionCount").str(_address.asString()).str(_blockNumber.asString()));
+            (*response).performModifier(mod_valueToCompactEvenHexPrefixed);
+            m_cache.putAccountField(RPCCache::AccountField::NONCE, _address, _blockNumber, response);
+        }
         if (response->type() == DataType::String)
             return spVALUE(new VALUE(response));
         return spVALUE(new VALUE(response->asInt()));
@@ -50,28 +68,51 @@ spVALUE RPCImpl::eth_getTransactionCount(FH20 const& _address, VALUE const& _blo
 
 VALUE RPCImpl::eth_blockNumber()
 {
-    return VALUE(rpcCall("eth_blockNumber", {}).getCContent());
+    return VALUE(rpcSend(m_request.begin("eth_blockNumber")).getCContent());
 }
 
 spEthGetBlockBy RPCImpl::eth_getBlockByHash(FH32 const& _hash, Request _fullObjects)
 {
-    spDataObject response = rpcCall("eth_getBlockByHash", {quote(_hash.asString()), _fullObjects == Request::FULLOBJECTS ? "true" : "false"});
-    ClientConfig const& cfg = Options::getCurrentConfig();
-    cfg.performFieldReplace(*response, FieldReplaceDir::ClientToRetesteth);
-    return spEthGetBlockBy(new EthGetBlockBy(response));
+    bool const fullObjects = _fullObjects == Request::FULLOBJECTS;
+    spEthGetBlockBy cached = m_cache.getBlockByHash(_hash, fullObjects);
+    if (!cached.isEmpty())
+    {
+        ETH_DC_MESSAGE(DC::RPC, "Cached: eth_getBlockByHash " + _hash.asString());
+        return cached;
+    }
+
+    CJOptions const replyOpt = fieldReplaceReplyOpt();
+    spDataObject response = rpcSend(m_request.begin("eth_getBlockByHash").str(_hash.asString()).boolean(fullObjects), false, replyOpt);
+    spEthGetBlockBy block(new EthGetBlockBy(response));
+    m_cache.putBlock(block, fullObjects, false);
+    return block;
 }
 
 spEthGetBlockBy RPCImpl::eth_getBlockByNumber(VALUE const& _blockNumber, Request _fullObjects)
 {
-    spDataObject response = rpcCall("eth_getBlockByNumber", {quote(_blockNumber.asString()), _fullObjects == Request::FULLOBJECTS ? "true" : "false"});
-    ClientConfig const& cfg = Options::getCurrentConfig();
-    cfg.performFieldReplace(*response, FieldReplaceDir::ClientToRetesteth);
-    return spEthGetBlockBy(new EthGetBlockBy(response));
+    bool const fullObjects = _fullObjects == Request::FULLOBJECTS;
+    spEthGetBlockBy cached = m_cache.getBlockByNumber(_blockNumber, fullObjects);
+    if (!cached.isEmpty())
+    {
+        ETH_DC_MESSAGE(DC::RPC, "Cached: eth_getBlockByNumber " + _blockNumber.asDecString());
+        return cached;
+    }
+
+    CJOptions const replyOpt = fieldReplaceReplyOpt();
+    spDataObject response = rpcSend(m_request.begin("eth_getBlockByNumber").str(_blockNumber.asString()).boolean(fullObjects), false, replyOpt);
+    spEthGetBlockBy block(new EthGetBlockBy(response));
+    m_cache.putBlock(block, fullObjects, true);
+    return block;
 }
 
 spBYTES RPCImpl::eth_getCode(FH20 const& _address, VALUE const& _blockNumber)
 {
-    spDataObject res = rpcCall("eth_getCode", {quote(_address.asString()), quote(_blockNumber.asString())});
+    spDataObject res = m_cache.getAccountField(RPCCache::AccountField::CODE, _address, _blockNumber);
+    if (res.isEmpty())
+    {
+        res = rpcSend(m_request.begin("eth_getCode").str(_address.asString()).str(_blockNumber.asString()));
+        m_cache.putAccountField(RPCCache::AccountField::CODE, _address, _blockNumber, res);
+    }
     if (res->asString().empty())
     {
         ETH_DC_MESSAGE(DC::LOWLOG, "eth_getCode return `` empty string, correct to `0x` empty bytes ");
@@ -82,7 +123,12 @@ spBYTES RPCImpl::eth_getCode(FH20 const& _address, VALUE const& _blockNumber)
 
 spVALUE RPCImpl::eth_getBalance(FH20 const& _address, VALUE const& _blockNumber)
 {
-    auto ret = rpcCall("eth_getBalance", {quote(_address.asString()), quote(_blockNumber.asString())});
+    spDataObject ret = m_cache.getAccountField(RPCCache::AccountField::BALANCE, _address, _blockNumber);
+    if (ret.isEmpty())
+    {
+        ret = rpcSend(m_request.begin("eth_getBalance").str(_address.asString()).str(_blockNumber.asString()));
+        m_cache.putAccountField(RPCCache::AccountField::BALANCE, _address, _blockNumber, ret);
+    }
     return spVALUE(new VALUE(ret));
 }
 
@@ -91,32 +137,46 @@ spVALUE RPCImpl::eth_getBalance(FH20 const& _address, VALUE const& _blockNumber)
 DebugAccountRange RPCImpl::debug_accountRange(
     VALUE const& _blockNumber, VALUE const& _txIndex, FH32 const& _address, size_t _maxResults)
 {
-    auto res = rpcCall("debug_accountRange",
-        {quote(_blockNumber.asDecString()), _txIndex.asDecString(), quote(_address.asString()), fto_string(_maxResults)});
+    auto res = rpcSend(m_request.begin("debug_accountRange")
+                           .str(_blockNumber.asDecString())
+                           .json(_txIndex.asDecString())
+                           .str(_address.asString())
+                           .num(_maxResults));
     return DebugAccountRange(res.getCContent());
 }
 
 DebugAccountRange RPCImpl::debug_accountRange(
     FH32 const& _blockHash, VALUE const& _txIndex, FH32 const& _address, size_t _maxResults)
 {
-    auto res = rpcCall("debug_accountRange",
-        {quote(_blockHash.asString()), _txIndex.asDecString(), quote(_address.asString()), fto_string(_maxResults)});
+    auto res = rpcSend(m_request.begin("debug_accountRange")
+                           .str(_blockHash.asString())
+                           .json(_txIndex.asDecString())
+                           .str(_address.asString())
+                           .num(_maxResults));
     return DebugAccountRange(res.getCContent());
 }
 
 DebugStorageRangeAt RPCImpl::debug_storageRangeAt(
     VALUE const& _blockNumber, VALUE const& _txIndex, FH20 const& _address, FH32 const& _begin, int _maxResults)
 {
-    auto res = rpcCall("debug_storageRangeAt", {quote(_blockNumber.asDecString()), _txIndex.asDecString(),
-                                               quote(_address.asString()), quote(_begin.asString()), fto_string(_maxResults)});
+    auto res = rpcSend(m_request.begin("debug_storageRangeAt")
+                           .str(_blockNumber.asDecString())
+                           .json(_txIndex.asDecString())
+                           .str(_address.asString())
+                           .str(_begin.asString())
+                           .num(_maxResults));
     return DebugStorageRangeAt(res.getCContent());
 }
 
 DebugStorageRangeAt RPCImpl::debug_storageRangeAt(
     FH32 const& _blockHash, VALUE const& _txIndex, FH20 const& _address, FH32 const& _begin, int _maxResults)
 {
-    auto res = rpcCall("debug_storageRangeAt", {quote(_blockHash.asString()), _txIndex.asDecString(), quote(_address.asString()),
-                                                quote(_begin.asString()), fto_string(_maxResults)});
+    auto res = rpcSend(m_request.begin("debug_storageRangeAt")
+                           .str(_blockHash.asString())
+                           .json(_txIndex.asDecString())
+                           .str(_address.asString())
+                           .str(_begin.asString())
+                           .num(_maxResults));
     return DebugStorageRangeAt(res.getCContent());
 }
 
@@ -141,27 +201,29 @@ void RPCImpl::test_setChainParams(spSetChainParamsArgs const& _config)
 
     ClientConfig const& cfg = Options::getCurrentConfig();
     spDataObject data = _config->asDataObject();
-    cfg.performFieldReplace(*data, FieldReplaceDir::RetestethToClient);
+    string const params = data->asJson(0, true, false, cfg.fieldReplaceMap(FieldReplaceDir::RetestethToClient));
 
-    spDataObject res =  rpcCall("test_setChainParams", {data->asJson()});
+    m_cache.onSetChainParams();
+    spDataObject res =  rpcSend(m_request.begin("test_setChainParams").json(params));
     ETH_ERROR_REQUIRE_MESSAGE(*res == true, "remote test_setChainParams = false");
 }
 
 void RPCImpl::test_rewindToBlock(VALUE const& _blockNr)
 {
-    spDataObject res = rpcCall("test_rewindToBlock", {_blockNr.asDecString()});
+    m_cache.onRewindToBlock(_blockNr);
+    spDataObject res = rpcSend(m_request.begin("test_rewindToBlock").json(_blockNr.asDecString()));
     ETH_FAIL_REQUIRE_MESSAGE(*res == true, "remote test_rewintToBlock = false");
 }
 
 void RPCImpl::test_modifyTimestamp(VALUE const& _timestamp)
 {
-    spDataObject res = rpcCall("test_modifyTimestamp", {_timestamp.asDecString()});
+    spDataObject res = rpcSend(m_request.begin("test_modifyTimestamp").json(_timestamp.asDecString()));
     ETH_FAIL_REQUIRE_MESSAGE(*res == true, "test_modifyTimestamp was not successfull");
 }
 
 MineBlocksResult RPCImpl::test_mineBlocks(size_t _number)
 {
-    spDataObject const res = rpcCall("test_mineBlocks", {to_string(_number)}, true);
+    spDataObject const res = rpcSend(m_request.begin("test_mineBlocks").num(_number), true);
 
     if (res->type() == DataType::Object)
     {
@@ -181,7 +243,8 @@ MineBlocksResult RPCImpl::test_mineBlocks(size_t _number)
 
 FH32 RPCImpl::test_importRawBlock(BYTES const& _blockRLP)
 {
-    spDataObject const res = rpcCall("test_importRawBlock", {quote(_blockRLP.asString())}, true);
+    m_cache.onImportRawBlock();
+    spDataObject const res = rpcSend(m_request.begin("test_importRawBlock").bytes(_blockRLP), true);
     if (res->type() == DataType::String && res->asString().size() > 2)
         return FH32(res->asString());
     return FH32::zero();
@@ -189,7 +252,7 @@ FH32 RPCImpl::test_importRawBlock(BYTES const& _blockRLP)
 
 FH32 RPCImpl::test_getLogHash(FH32 const& _txHash)
 {
-    return FH32(rpcCall("test_getLogHash", {quote(_txHash.asString())}));
+    return FH32(rpcSend(m_request.begin("test_getLogHash").str(_txHash.asString())));
 }
 
 void RPCImpl::test_registerWithdrawal(BYTES const& _rlp)
@@ -200,7 +263,7 @@ void RPCImpl::test_registerWithdrawal(BYTES const& _rlp)
 
 TestRawTransaction RPCImpl::test_rawTransaction(BYTES const& _rlp, FORK const& _fork)
 {
-    spDataObject const res = rpcCall("test_rawTransaction", {quote(_rlp.asString()), quote(_fork.asString())});
+    spDataObject const res = rpcSend(m_request.begin("test_rawTransaction").bytes(_rlp).str(_fork.asString()));
     return TestRawTransaction(res);
 }
 
@@ -215,15 +278,13 @@ std::string RPCImpl::test_rawEOFCode(BYTES const& _code, FORK const& _fork)
 VALUE RPCImpl::test_calculateDifficulty(FORK const& _fork, VALUE const& _blockNumber, VALUE const& _parentTimestamp,
     VALUE const& _parentDifficulty, VALUE const& _currentTimestamp, VALUE const& _uncleNumber)
 {
-    return VALUE(rpcCall("test_calculateDifficulty", {
-             quote(_fork.asString()),
-             quote(_blockNumber.asString()),
-             quote(_parentTimestamp.asString()),
-             quote(_parentDifficulty.asString()),
-             quote(_currentTimestamp.asString()),
-             quote(_uncleNumber.asString())
-            })
-        );
+    return VALUE(rpcSend(m_request.begin("test_calculateDifficulty")
+                             .str(_fork.asString())
+                             .str(_blockNumber.asString())
+                             .str(_parentTimestamp.asString())
+                             .str(_parentDifficulty.asString())
+                             .str(_currentTimestamp.asString())
+                             .str(_uncleNumber.asString())));
 }
 
 // Internal
@@ -236,22 +297,22 @@ std::string RPCImpl::sendRawRequest(std::string const& _request)
 spDataObject RPCImpl::rpcCall(
     std::string const& _methodName, std::vector<std::string> const& _args, bool _canFail)
 {
-    string request = "{\"jsonrpc\":\"2.0\",\"method\":\"" + _methodName + "\",\"params\":[";
-    for (size_t i = 0; i < _args.size(); ++i)
-    {
-        request += _args[i];
-        if (i + 1 != _args.size())
-            request += ", ";
-    }
-
-    request += "],\"id\":" + to_string(m_rpcSequence++) + "}";
+    m_request.begin(_methodName);
+    for (auto const& arg : _args)
+        m_request.json(arg);
+    return rpcSend(m_request, _canFail);
+}
 
+spDataObject RPCImpl::rpcSend(RPCRequest& _request, bool _canFail, CJOptions const& _replyOpt)
+{
+    ETH_TRACE_SPAN("rpcCall");
+    string const& request = _request.end(m_rpcSequence++);
     ETH_DC_MESSAGE(DC::RPC, "Request: " + request);
     JsonObjectValidator validator;  // read response while counting `{}`
     string reply = m_socket.sendRequest(request, validator);
     ETH_DC_MESSAGE(DC::RPC, "Reply: `" + reply + "`");
 
-    spDataObject result = ConvertJsoncppStringToData(reply);
+    spDataObject result = ConvertJsoncppStringToData(reply, _replyOpt);
     if (result->count("error"))
         (*result)["result"] = "";
 
@@ -1,4 +1,7 @@
 #pragma once
+#include <libdataobj/ConvertFile.h>
+#include <retesteth/session/RPCCache.h>
+#include <retesteth/session/RPCRequest.h>
 #include <retesteth/session/SessionInterface.h>
 #include <retesteth/session/Socket.h>
 #include <string>
@@ -61,8 +64,13 @@ public:
     std::string const& getSocketPath() const override;
 
 private:
+    // Send the request formatted in m_request, parse the reply with _replyOpt (i.e. key replace rules)
+    spDataObject rpcSend(RPCRequest& _request, bool _canFail = false, CJOptions const& _replyOpt = CJOptions());
+
     Socket m_socket;
+    RPCRequest m_request;
     size_t m_rpcSequence = 1;
+    RPCCache m_cache;
 };
 
 }  // namespace test::session
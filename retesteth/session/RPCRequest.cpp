@@ -0,0 +1,73 @@
+#include "RPCRequest.h"
+#include <charconv>
+
+using namespace std;
+
+namespace
+{
+string_view const c_requestHeader = "{\"jsonrpc\":\"2.0\",\"method\":\"";
+}
+
+namespace test::session
+{
+RPCRequest& RPCRequest::begin(string_view _method)
+{
+    m_buffer.clear();
+    m_buffer.append(c_requestHeader).append(_method).append("\",\"params\":[");
+    m_argsCount = 0;
+    return *this;
+}
+
+void RPCRequest::separator()
+{
+    if (m_argsCount++ > 0)
+        m_buffer.append(", ");
+}
+
+RPCRequest& RPCRequest::str(string_view _arg)
+{
+    separator();
+    m_buffer.reserve(m_buffer.size() + _arg.size() + 2);
+    m_buffer.push_back('"');
+    m_buffer.append(_arg);
+    m_buffer.push_back('"');
+    return *this;
+}
+
+RPCRequest& RPCRequest::bytes(test::teststruct::BYTES const& _arg)
+{
+    return str(_arg.asString());
+}
+
+RPCRequest& RPCRequest::num(size_t _arg)
+{
+    separator();
+    char buf[24];
+    auto const res = std::to_chars(buf, buf + sizeof(buf), _arg);
+    m_buffer.append(buf, res.ptr);
+    return *this;
+}
+
+RPCRequest& RPCRequest::boolean(bool _arg)
+{
+    separator();
+    m_buffer.append(_arg ? "true" : "false");
+    return *this;
+}
+
+RPCRequest& RPCRequest::json(string_view _arg)
+{
+    separator();
+    m_buffer.append(_arg);
+    return *this;
+}
+
+string const& RPCRequest::end(size_t _id)
+{
+    char buf[24];
+    auto const res = std::to_chars(buf, buf + sizeof(buf), _id);
+    m_buffer.append("],\"id\":").append(buf, res.ptr).push_back('}');
+    return m_buffer;
+}
+
+}  // namespace test::session
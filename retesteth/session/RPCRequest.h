@@ -0,0 +1,27 @@
+#pragma once
+#include <retesteth/testStructures/basetypes/BYTES.h>
+#include <string>
+#include <string_view>
+
+namespace test::session
+{
+// Json-rpc request formatted in place into a buffer that is reused between requests
+// {"jsonrpc":"2.0","method":"<method>","params":[<args>],"id":<id>}
+class RPCRequest
+{
+public:
+    RPCRequest& begin(std::string_view _method);
+    RPCRequest& str(std::string_view _arg);                  // "_arg"
+    RPCRequest& bytes(test::teststruct::BYTES const& _arg);  // "0x.." without a copy of the hex string
+    RPCRequest& num(size_t _arg);                            // decimal
+    RPCRequest& boolean(bool _arg);
+    RPCRequest& json(std::string_view _arg);                 // already serialized json
+    std::string const& end(size_t _id);
+
+private:
+    void separator();
+    std::string m_buffer;
+    size_t m_argsCount = 0;
+};
+
+}  // namespace test::session
@@ -27,7 +27,11 @@
 #include <retesteth/helpers/TestHelper.h>
 #include <retesteth/session/RPCImpl.h>
 #include <retesteth/session/ToolImpl.h>
+#include <algorithm>
+#include <condition_variable>
 #include <csignal>
+#include <iomanip>
+#include <list>
 
 using namespace std;
 using namespace dev;
@@ -48,6 +52,7 @@ struct sessionInfo
         isUsed = RPCSession::NotExist;
         configId = _configId;
         totalRuns = 0;
+        borrowed = false;
     }
     std::unique_ptr<RPCSession> session;
     std::unique_ptr<FILE> filePipe;
@@ -56,12 +61,84 @@ struct sessionInfo
     std::string tmpDir;
     test::ClientConfigID configId;
     size_t totalRuns;
+    bool borrowed;  // lent to a sub task of another thread
 };
 
 void closeSession(thread::id const& _threadID);
+void closeSessionInfo(sessionInfo& _info);
 
 std::mutex g_socketMapMutex;
 static std::map<thread::id, sessionInfo> socketMap;
+std::condition_variable g_borrowedCond;  // notified when a lent or finished session is released
+static size_t startingInstances = 0;  // clients that are being started outside of g_socketMapMutex
+
+// Always lock g_socketMapMutex before g_warmSparesMutex
+std::mutex g_warmSparesMutex;
+std::condition_variable g_warmSparesCond;
+static std::list<sessionInfo> warmSpares;
+static size_t warmSparesStarting = 0;  // spares that are being started in background
+static std::map<thread::id, thread> warmSpareThreads;   // joined in fillWarmSpares and clear()
+static std::vector<thread::id> finishedSpareThreads;  // spare threads that are about to exit
+static size_t retiredClosing = 0;      // recycled instances that are being closed in background
+static size_t totalSwaps = 0;
+static size_t totalColdRestarts = 0;
+static size_t totalRecycledOnReuse = 0;
+
+// Closing a client takes seconds, do not block the test execution
+// retiredClosing must be increased for the sessions before
+void closeInBackground(std::vector<sessionInfo>& _retired)
+{
+    for (auto& info : _retired)
+    {
+        thread task([](sessionInfo _info) {
+            closeSessionInfo(_info);
+            std::lock_guard<std::mutex> lock(g_warmSparesMutex);
+            retiredClosing--;
+            g_warmSparesCond.notify_all();
+        }, std::move(info));
+        task.detach();
+    }
+    _retired.clear();
+}
+
+// Poll _probe with exponential backoff until it succeeds or _maxWait is reached
+bool waitWithBackoff(std::function<bool()> const& _probe, chrono::milliseconds const& _maxWait)
+{
+    static chrono::milliseconds const c_maxDelay(500);
+    auto const start = chrono::steady_clock::now();
+    chrono::milliseconds delay(10);
+    while (!_probe())
+    {
+        if (ExitHandler::receivedExitSignal() || chrono::steady_clock::now() - start > _maxWait)
+            return false;
+        std::this_thread::sleep_for(delay);
+        delay = std::min(delay * 2, c_maxDelay);
+    }
+    return true;
+}
+
+// Stops a started client process unless its start is confirmed with release()
+class ClientStartGuard
+{
+public:
+    ClientStartGuard(FILE* _pipe, int _pid, fs::path const& _tmpDir) : m_pipe(_pipe), m_pid(_pid), m_tmpDir(_tmpDir) {}
+    ~ClientStartGuard()
+    {
+        if (m_pipe == nullptr)
+            return;
+        test::pclose2(m_pipe, m_pid);
+        boost::system::error_code ec;
+        fs::remove_all(m_tmpDir, ec);
+    }
+    ClientStartGuard(ClientStartGuard const&) = delete;
+    ClientStartGuard& operator=(ClientStartGuard const&) = delete;
+    void release() { m_pipe = nullptr; }
+
+private:
+    FILE* m_pipe;
+    int m_pid;
+    fs::path m_tmpDir;
+};
 
 void RPCSession::runNewInstanceOfAClient(thread::id const& _threadID, ClientConfig const& _config)
 {
@@ -69,42 +146,17 @@ void RPCSession::runNewInstanceOfAClient(thread::id const& _threadID, ClientConf
     {
     case ClientConfgSocketType::IPC:
     {
-        fs::path tmpDir = test::createUniqueTmpDirectory();
-        string ipcPath = tmpDir.string() + "/geth.ipc";
-
-        string command = "bash";
-        std::vector<string> args;
-        args.emplace_back(_config.getShellPath().c_str());
-        args.emplace_back(tmpDir.string());
-        args.emplace_back(ipcPath);
-
-        int pid = 0;
-        test::popenOutput mode =
-            (Options::get().enableClientsOutput) ? test::popenOutput::EnableALL : test::popenOutput::DisableAll;
-        FILE* fp = test::popen2(command, args, "r", pid, mode);
-        if (!fp)
+        std::unique_ptr<sessionInfo> info = startIPCInstance(_config);
         {
-            ETH_ERROR_MESSAGE("Failed to start the client: '" + command + "'");
-            std::raise(SIGABRT);
+            std::lock_guard<std::mutex> lock(g_socketMapMutex);
+            socketMap.insert(std::pair<thread::id, sessionInfo>(_threadID, std::move(*info)));
         }
-        else
-        {
-            int maxSeconds = 25;
-            while (!boost::filesystem::exists(ipcPath) && maxSeconds-- > 0)
-                std::this_thread::sleep_for(std::chrono::seconds(1));
-            ETH_FAIL_REQUIRE_MESSAGE(maxSeconds > 0, "Client took too long to start ipc!");
-            // Client has opened ipc socket. wait for it to initialize
-            ClientConfig const& curCFG = Options::getDynamicOptions().getCurrentConfig();
-            size_t const initTime = curCFG.cfgFile().initializeTime();
-            std::this_thread::sleep_for(std::chrono::seconds(initTime));
-        }
-        sessionInfo info(
-            fp, new RPCSession(new RPCImpl(Socket::SocketType::IPC, ipcPath)), tmpDir.string(), pid, _config.getId());
-        socketMap.insert(std::pair<thread::id, sessionInfo>(_threadID, std::move(info)));
+        fillWarmSpares(_config);
         break;
     }
     case ClientConfgSocketType::TCP:
     {
+        std::lock_guard<std::mutex> lock(g_socketMapMutex);
         Options const& opt = Options::get();
         std::vector<IPADDRESS> const& ports =
             (opt.nodesoverride.size() > 0 ? opt.nodesoverride : _config.cfgFile().socketAdresses());
@@ -142,6 +194,7 @@ void RPCSession::runNewInstanceOfAClient(thread::id const& _threadID, ClientConf
         FILE* fp = NULL;
         sessionInfo info(
             fp, new RPCSession(new RPCImpl(Socket::SocketType::IPC, ipcPath.string())), tmpDir.string(), pid, _config.getId());
+        std::lock_guard<std::mutex> lock(g_socketMapMutex);
         socketMap.insert(std::pair<thread::id, sessionInfo>(_threadID, std::move(info)));
         break;
     }
@@ -151,6 +204,7 @@ void RPCSession::runNewInstanceOfAClient(thread::id const& _threadID, ClientConf
         fs::path tmpDir = test::createUniqueTmpDirectory();
         sessionInfo info(NULL, new RPCSession(new ToolImpl(Socket::SocketType::TCP, _config.cfgFile().shell(), tmpDir)),
             tmpDir.string(), 0, _config.getId());
+        std::lock_guard<std::mutex> lock(g_socketMapMutex);
         socketMap.insert(std::pair<thread::id, sessionInfo>(_threadID, std::move(info)));
         break;
     }
@@ -159,6 +213,226 @@ void RPCSession::runNewInstanceOfAClient(thread::id const& _threadID, ClientConf
     }
 }
 
+std::unique_ptr<sessionInfo> RPCSession::startIPCInstance(ClientConfig const& _config, bool _isSpare)
+{
+    fs::path tmpDir = test::createUniqueTmpDirectory();
+    string ipcPath = tmpDir.string() + "/geth.ipc";
+
+    string command = "bash";
+    std::vector<string> args;
+    args.emplace_back(_config.getShellPath().c_str());
+    args.emplace_back(tmpDir.string());
+    args.emplace_back(ipcPath);
+
+    int pid = 0;
+    test::popenOutput mode =
+        (Options::get().enableClientsOutput) ? test::popenOutput::EnableALL : test::popenOutput::DisableAll;
+    FILE* fp = test::popen2(command, args, "r", pid, mode);
+    if (!fp)
+    {
+        // A failed spare must not abort the run, the thread will cold start a client instead
+        if (_isSpare)
+            throw std::runtime_error("Failed to start the client: '" + command + "'");
+        ETH_ERROR_MESSAGE("Failed to start the client: '" + command + "'");
+        std::raise(SIGABRT);
+    }
+    ClientStartGuard clientGuard(fp, pid, tmpDir);
+
+    // Wait for the client to open ipc socket and accept connections
+    // initializeTime is the upper bound of the client initialization now
+    size_t const initTime = _config.cfgFile().initializeTime();
+    chrono::milliseconds const maxWait((25 + initTime) * 1000);
+    bool const ready = waitWithBackoff(
+        [&ipcPath]() { return Socket::canConnect(Socket::SocketType::IPC, ipcPath); }, maxWait);
+    if (!ready && _isSpare)
+        throw std::runtime_error("Client took too long to start ipc!");
+    ETH_FAIL_REQUIRE_MESSAGE(ready, "Client took too long to start ipc!");
+
+    auto impl = std::make_unique<RPCImpl>(Socket::SocketType::IPC, ipcPath);
+    spDataObject const version = impl->web3_clientVersion();
+    ETH_DC_MESSAGE(DC::SOCKET, "Client is ready: " + version->asJson(0, false));
+
+    clientGuard.release();
+    return std::make_unique<sessionInfo>(fp, new RPCSession(impl.release()), tmpDir.string(), pid, _config.getId());
+}
+
+void RPCSession::fillWarmSpares(ClientConfig const& _config)
+{
+    std::lock_guard<std::mutex> lock(g_warmSparesMutex);
+
+    // The finished threads only release the lock before exit
+    for (auto const& id : finishedSpareThreads)
+    {
+        auto it = warmSpareThreads.find(id);
+        if (it != warmSpareThreads.end())
+        {
+            it->second.join();
+            warmSpareThreads.erase(it);
+        }
+    }
+    finishedSpareThreads.clear();
+
+    while (warmSpares.size() + warmSparesStarting < Options::get().warmClients && !ExitHandler::receivedExitSignal())
+    {
+        warmSparesStarting++;
+        // The thread could outlive the config object of a reloaded configuration
+        thread task([config = _config]() {
+            std::unique_ptr<sessionInfo> spare;
+            try
+            {
+                spare = startIPCInstance(config, true);
+            }
+            catch (std::exception const& _ex)
+            {
+                ETH_WARNING(string("Failed to start a warm client instance: ") + _ex.what());
+            }
+            std::lock_guard<std::mutex> lock(g_warmSparesMutex);
+            warmSparesStarting--;
+            if (spare)
+                warmSpares.push_back(std::move(*spare));
+            finishedSpareThreads.push_back(this_thread::get_id());
+            g_warmSparesCond.notify_all();
+        });
+        thread::id const id = task.get_id();
+        warmSpareThreads.emplace(id, std::move(task));
+    }
+}
+
+// Must be called under g_socketMapMutex
+bool RPCSession::takeWarmSpare(thread::id const& _threadID, ClientConfigID const& _configId)
+{
+    std::lock_guard<std::mutex> lock(g_warmSparesMutex);
+    for (auto it = warmSpares.begin(); it != warmSpares.end(); it++)
+    {
+        if (it->configId != _configId)
+            continue;
+        it->isUsed = SessionStatus::Working;
+        socketMap.insert(std::pair<thread::id, sessionInfo>(_threadID, std::move(*it)));
+        warmSpares.erase(it);
+        return true;
+    }
+    return false;
+}
+
+bool RPCSession::recyclesOnReuse()
+{
+    return Options::getDynamicOptions().getCurrentConfig().cfgFile().socketType() == ClientConfgSocketType::IPC;
+}
+
+// Must be called under g_socketMapMutex
+void RPCSession::retireOverusedSessions(ClientConfigID const& _configId)
+{
+    size_t const maxTestBeforeFlush = Options::get().recycleAfter;
+    std::vector<sessionInfo> retired;
+    for (auto it = socketMap.begin(); it != socketMap.end();)
+    {
+        sessionInfo const& info = it->second;
+        if (info.configId == _configId && info.isUsed == SessionStatus::Available && !info.borrowed &&
+            info.totalRuns > maxTestBeforeFlush)
+        {
+            retired.push_back(std::move(it->second));
+            it = socketMap.erase(it);
+        }
+        else
+            it++;
+    }
+    if (retired.empty())
+        return;
+
+    ETH_DC_MESSAGE(DC::RPC, "Recycle " + test::fto_string(retired.size()) + " client instances on reuse...");
+    {
+        std::lock_guard<std::mutex> lockSpares(g_warmSparesMutex);
+        retiredClosing += retired.size();
+        totalRecycledOnReuse += retired.size();
+    }
+    closeInBackground(retired);
+}
+
+void RPCSession::recycleInstances(ClientConfig const& _config)
+{
+    ETH_DC_MESSAGE(DC::RPC, "Recycle client instances...");
+    std::vector<sessionInfo> retired;
+    {
+        std::lock_guard<std::mutex> lock(g_socketMapMutex);
+        std::lock_guard<std::mutex> lockSpares(g_warmSparesMutex);
+        for (auto it = socketMap.begin(); it != socketMap.end();)
+        {
+            if (it->second.configId != _config.getId() || it->second.isUsed == SessionStatus::Working || it->second.borrowed)
+            {
+                it++;
+                continue;
+            }
+
+            retired.push_back(std::move(it->second));
+            auto spare = std::find_if(warmSpares.begin(), warmSpares.end(),
+                [&_config](sessionInfo const& _spare) { return _spare.configId == _config.getId(); });
+            if (spare != warmSpares.end())
+            {
+                // Swap in a pre-started client under the same thread id
+                spare->isUsed = retired.back().isUsed;
+                it->second = std::move(*spare);
+                warmSpares.erase(spare);
+                totalSwaps++;
+                it++;
+            }
+            else
+            {
+                // The thread will cold start a new instance on next request
+                it = socketMap.erase(it);
+                totalColdRestarts++;
+            }
+        }
+        retiredClosing += retired.size();
+    }
+
+    closeInBackground(retired);
+    fillWarmSpares(_config);
+}
+
+SessionInterface* RPCSession::borrowIdleSession()
+{
+    test::ClientConfigID const currentConfigId = Options::getDynamicOptions().getCurrentConfig().getId();
+    std::lock_guard<std::mutex> lock(g_socketMapMutex);
+    for (auto& el : socketMap)
+    {
+        sessionInfo& info = el.second;
+        bool const idle = info.isUsed == SessionStatus::Available || info.isUsed == SessionStatus::HasFinished;
+        if (idle && !info.borrowed && info.configId == currentConfigId)
+        {
+            info.borrowed = true;
+            return &info.session.get()->getImplementation();
+        }
+    }
+    return nullptr;
+}
+
+void RPCSession::returnSession(SessionInterface* _session)
+{
+    std::lock_guard<std::mutex> lock(g_socketMapMutex);
+    for (auto& el : socketMap)
+    {
+        if (&el.second.session.get()->getImplementation() == _session)
+        {
+            el.second.borrowed = false;
+            g_borrowedCond.notify_all();
+            return;
+        }
+    }
+}
+
+void RPCSession::printStats()
+{
+    std::lock_guard<std::mutex> lock(g_warmSparesMutex);
+    if (totalSwaps == 0 && totalColdRestarts == 0 && totalRecycledOnReuse == 0)
+        return;
+    std::cout << "*** Client instances recycled" << std::endl;
+    std::cout << std::left;
+    std::cout << std::setw(37) << "Swapped with warm spares: " << totalSwaps << "\n";
+    std::cout << std::setw(37) << "Cold restarted: " << totalColdRestarts << "\n";
+    std::cout << std::setw(37) << "Recycled on reuse: " << totalRecycledOnReuse << "\n";
+    std::cout << "\n";
+}
+
 void RPCSession::currentCfgCountTestRun()
 {
     std::lock_guard<std::mutex> lock(g_socketMapMutex);
@@ -173,13 +447,13 @@ void RPCSession::currentCfgCountTestRun()
 
 bool RPCSession::isRunningTooLong()
 {
-    static const size_t c_maxTestBeforeFlush = 1500;
+    size_t const maxTestBeforeFlush = Options::get().recycleAfter;
     std::lock_guard<std::mutex> lock(g_socketMapMutex);
     ClientConfig const& curCFG = Options::getDynamicOptions().getCurrentConfig();
     for (auto const& el : socketMap)
     {
         sessionInfo const& info = el.second;
-         if (info.configId.id() == curCFG.getId().id() && info.totalRuns > c_maxTestBeforeFlush)
+         if (info.configId.id() == curCFG.getId().id() && info.totalRuns > maxTestBeforeFlush)
              return true;
     }
     return false;
@@ -208,7 +482,12 @@ void RPCSession::restartScripts(bool _stop)
         };
         switch (curCFG.cfgFile().socketType())
         {
-        case ClientConfgSocketType::IPC: stop(); return;
+        case ClientConfgSocketType::IPC:
+            if (Options::get().warmClients > 0)
+                recycleInstances(curCFG);
+            else
+                stop();
+            return;
         case ClientConfgSocketType::TCP: stop(); return;
         default: break;
         }
@@ -217,7 +496,7 @@ void RPCSession::restartScripts(bool _stop)
 
     // If there are no clients started with this configuration, run the start script
     // Assume here that socketMap is open for single configuration at a time only
-    if (socketMap.empty())
+    if (socketMap.empty() && startingInstances == 0)
     {
         if (!fs::exists(curCFG.getStartScript()))
             return;
@@ -235,9 +514,19 @@ void RPCSession::restartScripts(bool _stop)
             thread task(cmd, start, test::fto_string(threads) + " 2>/dev/null");
             ETH_DC_MESSAGE(DC::RPC, start);
             task.detach();
+
+            // Wait until all client addresses accept connections, initializeTime is the upper bound
             size_t const initTime = curCFG.cfgFile().initializeTime();
             size_t const seconds = Options::get().lowcpu ? initTime * 5 : initTime;
-            this_thread::sleep_for(chrono::seconds(seconds));
+            std::vector<IPADDRESS> const& ports = curCFG.cfgFile().socketAdresses();
+            bool const ready = waitWithBackoff([&ports]() {
+                for (auto const& addr : ports)
+                    if (!Socket::canConnect(Socket::SocketType::TCP, addr.asString()))
+                        return false;
+                return true;
+            }, chrono::milliseconds(seconds * 1000));
+            if (!ready)
+                ETH_WARNING("Client start script `" + start + "` did not open all socket addresses in time!");
         }
         break;
         default:
@@ -248,47 +537,82 @@ void RPCSession::restartScripts(bool _stop)
 
 SessionInterface& RPCSession::instance(thread::id const& _threadID)
 {
-    std::lock_guard<std::mutex> lock(g_socketMapMutex);
-    bool needToCreateNew = false;
     test::ClientConfigID currentConfigId = Options::getDynamicOptions().getCurrentConfig().getId();
-    if (socketMap.count(_threadID) && socketMap.at(_threadID).configId != currentConfigId)
     {
-        // For this thread a session is opened but it is opened not for current tested client
-        ETH_FAIL_MESSAGE("A session opened for another client id!");
-    }
+        std::unique_lock<std::mutex> lock(g_socketMapMutex);
+        // A reused thread id could point to a session lent to another test
+        g_borrowedCond.wait(lock, [&_threadID]() { return !socketMap.count(_threadID) || !socketMap.at(_threadID).borrowed; });
+        if (socketMap.count(_threadID) && socketMap.at(_threadID).configId != currentConfigId)
+        {
+            // For this thread a session is opened but it is opened not for current tested client
+            ETH_FAIL_MESSAGE("A session opened for another client id!");
+        }
 
-    // If there are no clients running, instantiate them with starter scripts
-    restartScripts();
+        // If there are no clients running, instantiate them with starter scripts
+        restartScripts();
 
-    if (!socketMap.count(_threadID))
-    {
-        // look for free clients that already instantiated
-        for (auto& socket : socketMap)
+        if (socketMap.count(_threadID))
+            return socketMap.at(_threadID).session.get()->getImplementation();
+
+        while (true)
         {
-            if (socket.second.isUsed == SessionStatus::Available)
-                if (socket.second.configId == currentConfigId)
-                {
-                    socket.second.isUsed = SessionStatus::Working;
-                    socketMap.insert(std::pair<thread::id, sessionInfo>(_threadID, std::move(socket.second)));
-                    socketMap.erase(socketMap.find(socket.first));  // remove previous threadID assigment to this socket
-                    assert(socketMap.count(_threadID));
-                    return socketMap.at(_threadID).session.get()->getImplementation();
-                }
+            if (recyclesOnReuse())
+                retireOverusedSessions(currentConfigId);
+
+            // look for free clients that already instantiated
+            for (auto& socket : socketMap)
+            {
+                if (socket.second.isUsed == SessionStatus::Available && !socket.second.borrowed)
+                    if (socket.second.configId == currentConfigId)
+                    {
+                        socket.second.isUsed = SessionStatus::Working;
+                        socketMap.insert(std::pair<thread::id, sessionInfo>(_threadID, std::move(socket.second)));
+                        socketMap.erase(socketMap.find(socket.first));  // remove previous threadID assigment to this socket
+                        assert(socketMap.count(_threadID));
+                        return socketMap.at(_threadID).session.get()->getImplementation();
+                    }
+            }
+
+            if (takeWarmSpare(_threadID, currentConfigId))
+            {
+                fillWarmSpares(Options::getDynamicOptions().getCurrentConfig());
+                return socketMap.at(_threadID).session.get()->getImplementation();
+            }
+
+            // All instances are started. The free ones are lent to sub tasks of other tests
+            // or wait for ThreadManager to mark them available
+            bool const poolIsFull = socketMap.size() + startingInstances >= Options::get().threadCount;
+            bool const willBeReleased = std::any_of(socketMap.begin(), socketMap.end(), [&currentConfigId](auto const& _el) {
+                return _el.second.configId == currentConfigId &&
+                       (_el.second.borrowed || _el.second.isUsed == SessionStatus::HasFinished);
+            });
+            if (!poolIsFull || !willBeReleased)
+                break;
+            g_borrowedCond.wait_for(lock, chrono::milliseconds(100));
         }
-        needToCreateNew = true;
+        startingInstances++;
     }
-    if (needToCreateNew)
+
+    // Start the new client outside of g_socketMapMutex so that all threads could start their instances concurrently
+    size_t const threadID = std::hash<std::thread::id>()(_threadID);
+    ETH_DC_MESSAGE(DC::SOCKET, "Run new connection session for `" + test::fto_string(threadID) + "`");
+    try
     {
-        size_t const threadID = std::hash<std::thread::id>()(_threadID);
-        ETH_DC_MESSAGE(DC::SOCKET, "Run new connection session for `" + test::fto_string(threadID) + "`");
         runNewInstanceOfAClient(_threadID, Options::getDynamicOptions().getCurrentConfig());
-        ETH_DC_MESSAGE(DC::SOCKET, "New instance started");
     }
+    catch (...)
+    {
+        std::lock_guard<std::mutex> lock(g_socketMapMutex);
+        startingInstances--;
+        throw;
+    }
+    ETH_DC_MESSAGE(DC::SOCKET, "New instance started");
 
+    std::lock_guard<std::mutex> lock(g_socketMapMutex);
+    startingInstances--;
     ETH_FAIL_REQUIRE_MESSAGE(socketMap.size() <= Options::get().threadCount,
         "Something went wrong. Retesteth connect to more instances than needed!");
     ETH_FAIL_REQUIRE_MESSAGE(socketMap.size() != 0, "Something went wrong. Retesteth failed to create socket connection!");
-    size_t const threadID = std::hash<std::thread::id>()(_threadID);
     ETH_FAIL_REQUIRE_MESSAGE(
         socketMap.count(_threadID), "ThreadID: `" + fto_string(threadID) + "` not registered in socketMap!");
     return socketMap.at(_threadID).session.get()->getImplementation();
@@ -307,6 +631,7 @@ void RPCSession::sessionEnd(thread::id const& _threadID, SessionStatus _status)
     std::lock_guard<std::mutex> lock(g_socketMapMutex);
     if (socketMap.count(_threadID))
         socketMap.at(_threadID).isUsed = _status;
+    g_borrowedCond.notify_all();
 }
 
 RPCSession::SessionStatus RPCSession::sessionStatus(thread::id const& _threadID)
@@ -320,14 +645,18 @@ RPCSession::SessionStatus RPCSession::sessionStatus(thread::id const& _threadID)
 void closeSession(thread::id const& _threadID)
 {
     ETH_FAIL_REQUIRE_MESSAGE(socketMap.count(_threadID), "Socket map is empty in closeSession!");
-    sessionInfo& element = socketMap.at(_threadID);
-    if (element.session.get()->getImplementation().getSocketType() == Socket::SocketType::IPC)
+    closeSessionInfo(socketMap.at(_threadID));
+}
+
+void closeSessionInfo(sessionInfo& _info)
+{
+    if (_info.session.get()->getImplementation().getSocketType() == Socket::SocketType::IPC)
     {
-        test::pclose2(element.filePipe.get(), element.pipePid);
+        test::pclose2(_info.filePipe.get(), _info.pipePid);
         std::this_thread::sleep_for(std::chrono::seconds(4));
-        boost::filesystem::remove_all(boost::filesystem::path(element.tmpDir));
-        element.filePipe.release();
-        element.session.release();
+        boost::filesystem::remove_all(boost::filesystem::path(_info.tmpDir));
+        _info.filePipe.release();
+        _info.session.release();
     }
 }
 
@@ -345,6 +674,26 @@ void RPCSession::clear()
     socketMap.clear();
     closingThreads.clear();
 
+    // Wait for the background spares and close them as well
+    std::map<thread::id, thread> spareThreads;
+    {
+        std::unique_lock<std::mutex> lockSpares(g_warmSparesMutex);
+        g_warmSparesCond.wait(lockSpares, []() { return warmSparesStarting == 0 && retiredClosing == 0; });
+        spareThreads.swap(warmSpareThreads);
+        finishedSpareThreads.clear();
+    }
+    for (auto& th : spareThreads)
+        th.second.join();
+    {
+        std::lock_guard<std::mutex> lockSpares(g_warmSparesMutex);
+        for (auto& spare : warmSpares)
+            closingThreads.emplace_back(thread(closeSessionInfo, std::ref(spare)));
+        for (auto& th : closingThreads)
+            th.join();
+        warmSpares.clear();
+        closingThreads.clear();
+    }
+
     // If not running UnitTests or smth
     auto const& dynOpt = Options::getDynamicOptions();
     if (dynOpt.activeConfigs() > 0 && dynOpt.currentConfigIsSet())
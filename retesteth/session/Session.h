@@ -1,11 +1,14 @@
 #pragma once
 #include <boost/noncopyable.hpp>
+#include <memory>
 #include <thread>
 #include <retesteth/configs/ClientConfig.h>
 #include <retesteth/session/SessionInterface.h>
 
 namespace test::session
 {
+struct sessionInfo;
+
 // Session connections to an instance of a client
 class RPCSession : public boost::noncopyable
 {
@@ -28,6 +31,15 @@ public:
     static void currentCfgCountTestRun();            // Increase test run counter
     static bool isRunningTooLong();                  // True if running connection for tool long
     static void restartScripts(bool _stop = false);  // Stop all connections (flush)
+    static void printStats();                        // Client restarts for --exectimelog
+
+    // Over-used ipc instances are replaced one by one when a test takes them,
+    // so the running tests do not wait for a restart of all instances
+    static bool recyclesOnReuse();
+
+    // Lend an idle session of the current config to a sub task of a running test
+    static SessionInterface* borrowIdleSession();
+    static void returnSession(SessionInterface* _session);
 
     SessionInterface& getImplementation() { return *m_implementation; }
     ~RPCSession() { delete m_implementation; }
@@ -35,6 +47,13 @@ public:
 private:
     explicit RPCSession(SessionInterface* _impl);
     static void runNewInstanceOfAClient(std::thread::id const& _threadID, test::ClientConfig const& _config);
+    static std::unique_ptr<sessionInfo> startIPCInstance(test::ClientConfig const& _config, bool _isSpare = false);
+
+    // Pre-started ipc clients that replace the recycled ones (--warmclients)
+    static void fillWarmSpares(test::ClientConfig const& _config);
+    static bool takeWarmSpare(std::thread::id const& _threadID, test::ClientConfigID const& _configId);
+    static void recycleInstances(test::ClientConfig const& _config);
+    static void retireOverusedSessions(test::ClientConfigID const& _configId);
     SessionInterface* m_implementation;
 };
 
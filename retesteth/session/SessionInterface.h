@@ -75,7 +75,22 @@ public:
     virtual FH32 test_getLogHash(FH32 const& _txHash) = 0;
     virtual void test_registerWithdrawal(BYTES const& _rlp) = 0;
     virtual TestRawTransaction test_rawTransaction(BYTES const& _rlp, FORK const& _fork) = 0;
+    // Results of many transactions on one fork, backends could check them in one call
+    virtual std::vector<TestRawTransaction> test_rawTransactions(std::vector<BYTES> const& _rlps, FORK const& _fork)
+    {
+        std::vector<TestRawTransaction> res;
+        for (auto const& rlp : _rlps)
+            res.emplace_back(test_rawTransaction(rlp, _fork));
+        return res;
+    }
     virtual std::string test_rawEOFCode(BYTES const& _code, FORK const& _fork) = 0;
+    virtual std::vector<std::string> test_rawEOFCodes(std::vector<BYTES> const& _codes, FORK const& _fork)
+    {
+        std::vector<std::string> res;
+        for (auto const& code : _codes)
+            res.emplace_back(test_rawEOFCode(code, _fork));
+        return res;
+    }
     virtual VALUE test_calculateDifficulty(FORK const& _fork, VALUE const& _blockNumber, VALUE const& _parentTimestamp,
         VALUE const& _parentDifficulty, VALUE const& _currentTimestamp, VALUE const& _uncleNumber) = 0;
 
@@ -90,7 +105,6 @@ public:
     virtual ~SessionInterface() {}
 
 protected:
-    inline std::string quote(std::string const& _arg) { return "\"" + _arg + "\""; }
     RPCError m_lastInterfaceError;
 };
 
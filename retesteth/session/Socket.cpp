@@ -81,6 +81,48 @@ Socket::Socket(SocketType _type, string const& _path) : m_path(_path), m_socketT
 #endif
 }
 
+#if !defined(_WIN32)
+bool Socket::canConnect(SocketType _type, string const& _path)
+{
+    int sock = -1;
+    int res = -1;
+    if (_type == SocketType::IPC)
+    {
+        if (_path.length() >= sizeof(sockaddr_un::sun_path))
+            return false;
+        struct sockaddr_un saun;
+        memset(&saun, 0, sizeof(sockaddr_un));
+        saun.sun_family = AF_UNIX;
+        strcpy(saun.sun_path, _path.c_str());
+#if defined(__APPLE__)
+        saun.sun_len = sizeof(struct sockaddr_un);
+#endif
+        if ((sock = socket(AF_UNIX, SOCK_STREAM, 0)) < 0)
+            return false;
+        res = connect(sock, reinterpret_cast<struct sockaddr const*>(&saun), sizeof(struct sockaddr_un));
+    }
+    else
+    {
+        size_t const pos = _path.find_last_of(':');
+        string address = _path.substr(0, pos);
+        size_t const proto = address.find("://");
+        if (proto != string::npos)
+            address = address.substr(proto + 3);
+
+        struct sockaddr_in sin;
+        memset(&sin, 0, sizeof(sockaddr_in));
+        sin.sin_family = AF_INET;
+        sin.sin_addr.s_addr = inet_addr(address.c_str());
+        sin.sin_port = htons(atoi(_path.substr(pos + 1).c_str()));
+        if ((sock = socket(AF_INET, SOCK_STREAM, 0)) < 0)
+            return false;
+        res = connect(sock, reinterpret_cast<struct sockaddr const*>(&sin), sizeof(struct sockaddr_in));
+    }
+    close(sock);
+    return res == 0;
+}
+#endif
+
 namespace
 {
 std::size_t writecallback(const char* in, std::size_t size, std::size_t num, std::string* out)
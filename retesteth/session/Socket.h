@@ -65,6 +65,9 @@ public:
     std::string sendRequest(std::string const& _req, SocketResponseValidator& _responseValidator);
     ~Socket() { close(m_socket); }
 
+    // Try to connect to _path without failing the test. Used as a client readiness probe
+    static bool canConnect(SocketType _type, std::string const& _path);
+
     std::string const& path() const { return m_path; }
     SocketType type() const { return m_socketType; }
 
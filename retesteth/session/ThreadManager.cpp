@@ -4,6 +4,8 @@
 #include <retesteth/ExitHandler.h>
 #include <retesteth/Options.h>
 #include <retesteth/helpers/TestHelper.h>
+#include <retesteth/helpers/TestOutputHelper.h>
+#include <atomic>
 #include <condition_variable>
 
 size_t g_activejobs = 0;
@@ -11,6 +13,18 @@ std::mutex g_jobsmutex;
 std::condition_variable g_cv;
 std::mutex g_callbackmutex;
 using namespace std;
+namespace fs = boost::filesystem;
+
+namespace
+{
+// Errors of a worker thread count as errors of the test that started it
+void moveErrorsTo(test::TestOutputHelper& _parent)
+{
+    test::TestOutputHelper& helper = test::TestOutputHelper::get();
+    _parent.addErrors(helper.getErrors());
+    helper.resetErrors();
+}
+}  // namespace
 
 namespace test::session
 {
@@ -117,6 +131,116 @@ void ThreadManager::joinThreads(bool _all)
     }
 }
 
+void ThreadManager::runSubTasks(size_t _tasks, SessionInterface& _own, SubTaskInit const& _init, SubTask const& _task)
+{
+    std::vector<SessionInterface*> borrowed;
+    while (borrowed.size() + 1 < _tasks)
+    {
+        SessionInterface* session = RPCSession::borrowIdleSession();
+        if (session == nullptr)
+            break;
+        borrowed.emplace_back(session);
+    }
+
+    std::atomic<size_t> nextTask = 0;
+    std::atomic<bool> failed = false;
+    std::exception_ptr failure;
+    std::mutex failureMutex;
+    auto worker = [&](SessionInterface& _session, bool _borrowed) {
+        try
+        {
+            if (_borrowed)
+                _init(_session);
+            size_t i;
+            while (!failed && (i = nextTask++) < _tasks)
+                _task(_session, i);
+        }
+        catch (...)
+        {
+            std::lock_guard<std::mutex> lock(failureMutex);
+            if (!failed)
+                failure = std::current_exception();
+            failed = true;
+        }
+    };
+
+    // Sub task threads report errors for the same test
+    TestOutputHelper& parent = TestOutputHelper::get();
+    string const testName = parent.testName();
+    fs::path const testFile = parent.testFile();
+    TestInfo::CaseNames const testCase = parent.queuedTestCase();
+    std::vector<thread> workers;
+    for (auto* session : borrowed)
+        workers.emplace_back([&, session]() {
+            TestOutputHelper::get().setQueuedTestCase(testCase);
+            TestOutputHelper::get().setCurrentTestName(testName);
+            TestOutputHelper::get().setCurrentTestFile(testFile);
+            worker(*session, true);
+            moveErrorsTo(parent);
+        });
+    if (workers.size())
+        ETH_DC_MESSAGE(test::debug::DC::TESTLOG, "Split " + test::fto_string(_tasks) + " sub tasks across " +
+                                        test::fto_string(workers.size() + 1) + " sessions");
+
+    worker(_own, false);
+    for (auto& th : workers)
+        th.join();
+    for (auto* session : borrowed)
+        RPCSession::returnSession(session);
+    if (failure)
+        std::rethrow_exception(failure);
+}
+
+void ThreadManager::runParallel(size_t _tasks, std::function<void(size_t)> const& _task)
+{
+    size_t const threadCount = std::min<size_t>(_tasks, Options::get().threadCount);
+    if (threadCount <= 1)
+    {
+        for (size_t i = 0; i < _tasks; i++)
+            _task(i);
+        return;
+    }
+
+    std::atomic<size_t> nextTask = 0;
+    std::atomic<bool> failed = false;
+    std::exception_ptr failure;
+    std::mutex failureMutex;
+    auto worker = [&]() {
+        try
+        {
+            size_t i;
+            while (!failed && !ExitHandler::receivedExitSignal() && (i = nextTask++) < _tasks)
+                _task(i);
+        }
+        catch (...)
+        {
+            std::lock_guard<std::mutex> lock(failureMutex);
+            if (!failed)
+                failure = std::current_exception();
+            failed = true;
+        }
+    };
+
+    TestOutputHelper& parent = TestOutputHelper::get();
+    string const testName = parent.testName();
+    fs::path const testFile = parent.testFile();
+    TestInfo::CaseNames const testCase = parent.queuedTestCase();
+    std::vector<thread> workers;
+    for (size_t i = 1; i < threadCount; i++)
+        workers.emplace_back([&]() {
+            TestOutputHelper::get().setQueuedTestCase(testCase);
+            TestOutputHelper::get().setCurrentTestName(testName);
+            TestOutputHelper::get().setCurrentTestFile(testFile);
+            worker();
+            moveErrorsTo(parent);
+        });
+    worker();
+    for (auto& th : workers)
+        th.join();
+    if (failure)
+        std::rethrow_exception(failure);
+}
+
 void ThreadManager::waitForAtLeastOneJobToFinish()
 {
     std::unique_lock<std::mutex> lkj(g_jobsmutex);
@@ -2,6 +2,7 @@
 #include <map>
 #include <thread>
 #include <functional>
+#include <retesteth/session/SessionInterface.h>
 
 namespace test::session
 {
@@ -12,6 +13,18 @@ class ThreadManager
 public:
     static void joinThreads(bool _all = true);
     static void addTask(std::function<void()> _job);
+
+    // Split _tasks of a running test between _own session and idle sessions of the other threads
+    // _init prepares a borrowed session, _task(session, i) runs the task i. Rethrows the first failure
+    // Errors of the sub tasks are added to the errors of the calling thread
+    // Used by the state test filler only, running a filled test executes all transactions on its own session
+    typedef std::function<void(SessionInterface&)> SubTaskInit;
+    typedef std::function<void(SessionInterface&, size_t)> SubTask;
+    static void runSubTasks(size_t _tasks, SessionInterface& _own, SubTaskInit const& _init, SubTask const& _task);
+
+    // Run _task(i) for i < _tasks on up to -j threads without client sessions
+    // Stops taking new tasks after a failure and rethrows it. Errors are added to the calling thread
+    static void runParallel(size_t _tasks, std::function<void(size_t)> const& _task);
 private:
     ThreadManager() {}
     static void waitForAtLeastOneJobToFinish();
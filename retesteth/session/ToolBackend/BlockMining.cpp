@@ -1,10 +1,13 @@
 #include "BlockMining.h"
 #include "Options.h"
 #include "ToolChainHelper.h"
+#include "ToolStateReader.h"
 #include "libdataobj/ConvertFile.h"
+#include <boost/algorithm/string/join.hpp>
 #include <libdevcore/CommonIO.h>
 #include <retesteth/helpers/TestHelper.h>
 #include <retesteth/helpers/TestOutputHelper.h>
+#include <retesteth/helpers/TraceSpan.h>
 #include <retesteth/testStructures/Common.h>
 #include <testStructures/types/BlockchainTests/BlockchainTestFiller.h>
 #include <regex>
@@ -21,6 +24,7 @@ namespace toolimpl
 {
 void BlockMining::prepareEnvFile()
 {
+    ETH_TRACE_SPAN("BlockMining::prepareEnvFile");
     m_envPath = m_chainRef.tmpDir() / "env.json";
     auto const& cfgFile = Options::getCurrentConfig().cfgFile();
 
@@ -83,21 +87,22 @@ void BlockMining::prepareEnvFile()
     }
 
     // Options Hook
-    Options::getCurrentConfig().performFieldReplace(envData.getContent(), FieldReplaceDir::RetestethToClient);
-
-    m_envPathContent = envData->asJson();
+    KeyReplaceMap const* fieldReplace = Options::getCurrentConfig().fieldReplaceMap(FieldReplaceDir::RetestethToClient);
+    m_envPathContent = envData->asJson(0, true, false, fieldReplace);
     writeFile(m_envPath.string(), m_envPathContent);
 }
 
 void BlockMining::prepareAllocFile()
 {
+    ETH_TRACE_SPAN("BlockMining::prepareAllocFile");
     m_allocPath = m_chainRef.tmpDir() / "alloc.json";
-    m_allocPathContent = m_currentBlockRef.state()->asDataObject()->asJsonNoFirstKey();
+    m_allocPathContent = m_chainRef.allocJson(m_currentBlockRef.state());
     writeFile(m_allocPath.string(), m_allocPathContent);
 }
 
 void BlockMining::prepareTxnFile()
 {
+    ETH_TRACE_SPAN("BlockMining::prepareTxnFile");
     bool const exportRLP = !Options::getCurrentConfig().cfgFile().transactionsAsJson();
     string const txsfile = exportRLP ? "txs.rlp" : "txs.json";
     m_txsPath = m_chainRef.tmpDir() / txsfile;
@@ -130,57 +135,60 @@ void BlockMining::prepareTxnFile()
                 ETH_WARNING("Retesteth rejecting tx with gasLimit > 64 bits for tool" +
                             TestOutputHelper::get().testInfo().errorDebug());
         }
-        Options::getCurrentConfig().performFieldReplace(txs, FieldReplaceDir::RetestethToClient);
-        m_txsPathContent = txs.asJson();
+        KeyReplaceMap const* fieldReplace = Options::getCurrentConfig().fieldReplaceMap(FieldReplaceDir::RetestethToClient);
+        m_txsPathContent = txs.asJson(0, true, false, fieldReplace);
         writeFile(m_txsPath.string(), m_txsPathContent);
     }
 }
 
 void BlockMining::executeTransition()
 {
+    ETH_TRACE_SPAN("BlockMining::executeTransition");
     m_outPath = m_chainRef.tmpDir() / "out.json";
     m_outAllocPath = m_chainRef.tmpDir() / "outAlloc.json";
     m_outErrorPath = m_chainRef.tmpDir() / "error.json";
 
-    m_cmd = m_chainRef.toolPath().string();
+    m_args.clear();
+    m_args.emplace_back(m_chainRef.toolPath().string());
 
     // Convert FrontierToHomesteadAt5 -> Homestead if block > 5, and get reward
     auto tupleRewardFork = prepareReward(m_engine, m_chainRef.fork(), m_currentBlockRef);
-    m_cmd += " --state.fork " + std::get<1>(tupleRewardFork).asString();
+    m_args.insert(m_args.end(), {"--state.fork", std::get<1>(tupleRewardFork).asString()});
 
     if (m_engine == SealEngine::NoReward)
-        m_cmd += " --state.reward 0";
+        m_args.insert(m_args.end(), {"--state.reward", "0"});
     else
     {
         if (m_engine == SealEngine::Genesis)
-            m_cmd += " --state.reward -1";
+            m_args.insert(m_args.end(), {"--state.reward", "-1"});
         else
-            m_cmd += " --state.reward " + std::get<0>(tupleRewardFork).asDecString();
+            m_args.insert(m_args.end(), {"--state.reward", std::get<0>(tupleRewardFork).asDecString()});
     }
 
     auto const& params = m_chainRef.params().getCContent().params();
     if (params.count("chainID"))
-        m_cmd += " --state.chainid " + VALUE(params.atKey("chainID")).asDecString();
+        m_args.insert(m_args.end(), {"--state.chainid", VALUE(params.atKey("chainID")).asDecString()});
 
-    m_cmd += " --input.alloc " + m_allocPath.string();
-    m_cmd += " --input.txs " + m_txsPath.string();
-    m_cmd += " --input.env " + m_envPath.string();
-    m_cmd += " --output.basedir " + m_chainRef.tmpDir().string();
-    m_cmd += " --output.result " + m_outPath.filename().string();
-    m_cmd += " --output.alloc " + m_outAllocPath.filename().string();
-    m_cmd += " --output.errorlog " + m_outErrorPath.string();
+    m_args.insert(m_args.end(), {"--input.alloc", m_allocPath.string()});
+    m_args.insert(m_args.end(), {"--input.txs", m_txsPath.string()});
+    m_args.insert(m_args.end(), {"--input.env", m_envPath.string()});
+    m_args.insert(m_args.end(), {"--output.basedir", m_chainRef.tmpDir().string()});
+    m_args.insert(m_args.end(), {"--output.result", m_outPath.filename().string()});
+    m_args.insert(m_args.end(), {"--output.alloc", m_outAllocPath.filename().string()});
+    m_args.insert(m_args.end(), {"--output.errorlog", m_outErrorPath.string()});
 
     bool traceCondition = Options::get().vmtrace && m_currentBlockRef.header()->number() != 0;
     if (traceCondition)
     {
-        m_cmd += " --trace ";
+        m_args.emplace_back("--trace");
         if (!Options::get().vmtrace_nomemory)
-            m_cmd += "--trace.memory ";
+            m_args.emplace_back("--trace.memory");
         if (!Options::get().vmtrace_noreturndata)
-            m_cmd += "--trace.returndata ";
+            m_args.emplace_back("--trace.returndata");
         if (Options::get().vmtrace_nostack)
-            m_cmd += "--trace.nostack ";
+            m_args.emplace_back("--trace.nostack");
     }
+    m_cmd = boost::algorithm::join(m_args, " ");
 
     ETH_DC_MESSAGE(DC::RPC, "Alloc:\n" + m_allocPathContent);
     if (m_currentBlockRef.transactions().size())
@@ -193,7 +201,7 @@ void BlockMining::executeTransition()
 
     int exitcode;
     TestOutputHelper::get().timer().startSubcallTimer();
-    string out = test::executeCmd(m_cmd, exitcode, ExecCMDWarning::NoWarningNoError);
+    string out = test::executeProcess(m_args, exitcode, ExecCMDWarning::NoWarningNoError);
     TestOutputHelper::get().timer().finishSubcallTimer();
     ETH_DC_MESSAGE(DC::RPC, m_cmd);
     if (exitcode != 0)
@@ -207,6 +215,7 @@ void BlockMining::executeTransition()
 
 ToolResponse BlockMining::readResult()
 {
+    ETH_TRACE_SPAN("BlockMining::readResult");
     const string outPathContent = dev::contentsString(m_outPath.string());
     const string outAllocPathContent = dev::contentsString(m_outAllocPath.string());
     ETH_DC_MESSAGE(DC::RPC, "Res:\n" + outPathContent);
@@ -226,8 +235,7 @@ ToolResponse BlockMining::readResult()
 
     // Construct block rpc response
     ToolResponse toolResponse(ConvertJsoncppStringToData(outPathContent));
-    spDataObject returnState = ConvertJsoncppStringToData(outAllocPathContent);
-    toolResponse.attachState(restoreFullState(returnState.getContent()));
+    toolResponse.attachState(readToolState(outAllocPathContent, m_currentBlockRef.state()));
 
     const bool traceCondition = Options::get().vmtrace && m_currentBlockRef.header()->number() != 0;
     if (traceCondition)
@@ -238,6 +246,7 @@ ToolResponse BlockMining::readResult()
 
 void BlockMining::traceTransactions(ToolResponse& _toolResponse)
 {
+    ETH_TRACE_SPAN("BlockMining::traceTransactions");
     size_t i = 0;
     for (auto const& tr : m_currentBlockRef.transactions())
     {
@@ -39,6 +39,7 @@ private:
     boost::filesystem::path m_outPath;
     boost::filesystem::path m_outAllocPath;
     boost::filesystem::path m_outErrorPath;
+    std::vector<std::string> m_args;
     std::string m_cmd;
     void traceTransactions(ToolResponse& _toolResponse);
 };
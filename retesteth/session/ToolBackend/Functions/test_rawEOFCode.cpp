@@ -1,7 +1,14 @@
 #include <retesteth/session/ToolBackend/ToolChainManager.h>
 #include <retesteth/testStructures/basetypes.h>
 #include <libdevcore/CommonIO.h>
+#include <retesteth/helpers/Process.h>
 #include <retesteth/helpers/TestHelper.h>
+#include <boost/algorithm/string.hpp>
+#include <boost/algorithm/string/join.hpp>
+#include <boost/algorithm/string/trim.hpp>
+#include <algorithm>
+#include <mutex>
+#include <set>
 using namespace std;
 using namespace dev;
 using namespace test;
@@ -9,28 +16,96 @@ using namespace test::debug;
 using namespace toolimpl;
 namespace fs = boost::filesystem;
 
+namespace
+{
+// A valid code is reported as `ok.`, the tool might print `OK` followed by the code
+string eofResult(string const& _out)
+{
+    string const line = boost::trim_copy(_out);
+    return boost::istarts_with(line, "ok") ? "ok." : line;
+}
+}  // namespace
 
 string ToolChainManager::test_rawEOFCode(
     BYTES const& _code, FORK const& _fork, fs::path const& _toolPath, fs::path const& _tmpDir)
 {
-    (void) _fork;
-    fs::path const errorLog = _tmpDir / "error.txt";
-
-    string cmd = _toolPath.string();
-    cmd += " eof";
-    cmd += " --state.fork " + _fork.asString();
-    cmd += " --hex " + _code.asString();
-    cmd += " 2>" + errorLog.string();
-
-    ETH_DC_MESSAGE(DC::RPC, cmd);
-    int exitCode;
-    string response = test::executeCmd(cmd, exitCode, ExecCMDWarning::NoWarningNoError);
-    if (exitCode != 0)
+    (void) _tmpDir;
+    std::vector<string> const args = {_toolPath.string(), "eof", "--state.fork", _fork.asString(), "--hex", _code.asString()};
+
+    ETH_DC_MESSAGE(DC::RPC, boost::algorithm::join(args, " "));
+    ProcessResult const res = test::runProcess(args, ProcessStderr::Capture);
+    if (res.exitCode != 0)
     {
-        string const outErrorContent = dev::contentsString(errorLog.string());
-        ETH_DC_MESSAGE(DC::RPC, "Tool Error:\n" + outErrorContent);
-        return outErrorContent;
-        //throw test::UpwardsException(errorLog.empty() ? (response.empty() ? "Tool failed: " + cmd : response) : outErrorContent);
+        ETH_DC_MESSAGE(DC::RPC, "Tool Error:\n" + res.err);
+        return res.err;
     }
-    return response;
+    return eofResult(res.out);
+}
+
+namespace
+{
+// Tools that failed to validate a list of codes in one run
+std::mutex g_noBatchToolsMutex;
+std::set<fs::path> g_noBatchTools;
+
+bool batchSupported(fs::path const& _toolPath)
+{
+    std::lock_guard<std::mutex> lock(g_noBatchToolsMutex);
+    return !g_noBatchTools.count(_toolPath);
+}
+
+// The tool reads codes from stdin one per line when --hex is not given
+// and prints a result line per code: `OK ...` or the error
+bool runBatch(std::vector<BYTES> const& _codes, FORK const& _fork, fs::path const& _toolPath, fs::path const& _tmpDir,
+    std::vector<string>& _results)
+{
+    fs::path const codesPath = _tmpDir / "eof.txt";
+    string codes;
+    for (auto const& code : _codes)
+        codes += code.asString().substr(2) + "\n";
+    writeFile(codesPath.string(), codes);
+
+    std::vector<string> const args = {_toolPath.string(), "eof", "--state.fork", _fork.asString()};
+    ETH_DC_MESSAGE(DC::RPC, _toolPath.string() + " eof --state.fork " + _fork.asString() + " < " + codesPath.string());
+    ProcessResult const res = test::runProcess(args, ProcessStderr::Capture, codesPath);
+    if (res.exitCode != 0)
+    {
+        ETH_DC_MESSAGE(DC::RPC, "Tool Error:\n" + res.err);
+        return false;
+    }
+
+    std::vector<string> lines;
+    boost::split(lines, boost::trim_copy(res.out), boost::is_any_of("\n"));
+    if (lines.size() != _codes.size())
+        return false;
+    for (auto& line : lines)
+    {
+        line = eofResult(line);
+        if (line != "ok." && !boost::starts_with(line, "err"))
+            return false;
+    }
+    _results = std::move(lines);
+    return true;
+}
+}  // namespace
+
+std::vector<string> ToolChainManager::test_rawEOFCodes(
+    std::vector<BYTES> const& _codes, FORK const& _fork, fs::path const& _toolPath, fs::path const& _tmpDir)
+{
+    std::vector<string> results;
+    // Empty lines are not read as codes
+    bool const hasEmptyCode = std::any_of(_codes.begin(), _codes.end(), [](BYTES const& _code) { return _code.asString().size() <= 2; });
+    if (_codes.size() > 1 && !hasEmptyCode && batchSupported(_toolPath))
+    {
+        if (runBatch(_codes, _fork, _toolPath, _tmpDir, results))
+            return results;
+
+        ETH_DC_MESSAGE(DC::RPC, "Tool did not validate EOF code list, using a tool call per code");
+        std::lock_guard<std::mutex> lock(g_noBatchToolsMutex);
+        g_noBatchTools.emplace(_toolPath);
+    }
+
+    for (auto const& code : _codes)
+        results.emplace_back(test_rawEOFCode(code, _fork, _toolPath, _tmpDir));
+    return results;
 }
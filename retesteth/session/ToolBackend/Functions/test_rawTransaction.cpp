@@ -4,7 +4,9 @@
 #include <retesteth/Options.h>
 #include <retesteth/EthChecks.h>
 #include <retesteth/helpers/TestHelper.h>
+#include <boost/algorithm/string/join.hpp>
 #include <libdevcore/CommonIO.h>
+#include <libdevcore/RLP.h>
 #include <libdevcore/SHA3.h>
 using namespace std;
 using namespace dev;
@@ -14,48 +16,34 @@ using namespace toolimpl;
 using namespace test::session;
 namespace fs = boost::filesystem;
 
-TestRawTransaction ToolChainManager::test_rawTransaction(
-    BYTES const& _rlp, FORK const& _fork, fs::path const& _toolPath, fs::path const& _tmpDir)
+namespace
+{
+// Run t9n with the txs file content and return the array of transaction results
+spDataObject runT9n(string const& _txs, FORK const& _fork, fs::path const& _toolPath, fs::path const& _tmpDir,
+    string& _response, bool& _errorCaught)
 {
-    // Prepare test_mineBlocks response structure
-    DataObject out;
-    out["result"] = true;
-
     // Prepare transaction file
     fs::path const txsPath = _tmpDir / "tx.rlp";
     fs::path const errorLog = _tmpDir / "error.txt";
 
-    // Rlp list header builder for given data
-    test::RLPStreamU txsout(1);
-    if (_rlp.firstByte() < 128)
-    {
-        // wrap typed transactions as RLPstring in RLPStream
-        txsout.appendString(_rlp.asString());
-    }
-    else
-        txsout.appendRaw(_rlp.asString());
-
-    // Write data with memory allocation but faster
-    writeFile(txsPath.string(), string("\"") + txsout.outHeader() + _rlp.asString().substr(2) + "\"");
-    ETH_DC_MESSAGE(DC::RPC, "TXS file:\n" + string("\"") + txsout.outHeader() + _rlp.asString().substr(2) + "\"");
+    writeFile(txsPath.string(), _txs);
+    ETH_DC_MESSAGE(DC::RPC, "TXS file:\n" + _txs);
 
-    string cmd = _toolPath.string();
-    cmd += " --input.txs " + txsPath.string();
-    cmd += " --state.fork " + _fork.asString();
-    cmd += " --output.errorlog " + errorLog.string();
+    std::vector<string> const args = {_toolPath.string(), "--input.txs", txsPath.string(), "--state.fork", _fork.asString(),
+        "--output.errorlog", errorLog.string()};
 
-    ETH_DC_MESSAGE(DC::RPC, cmd);
+    ETH_DC_MESSAGE(DC::RPC, boost::algorithm::join(args, " "));
     int exitCode;
-    string response = test::executeCmd(cmd, exitCode, ExecCMDWarning::NoWarningNoError);
+    _response = test::executeProcess(args, exitCode, ExecCMDWarning::NoWarningNoError);
 
 
-    ETH_DC_MESSAGE(DC::RPC, "T9N Response:\n" + response);
+    ETH_DC_MESSAGE(DC::RPC, "T9N Response:\n" + _response);
     spDataObject res;
-    bool errorCaught = false;
+    _errorCaught = false;
 
     try
     {
-        res = dataobject::ConvertJsoncppStringToData(response);
+        res = dataobject::ConvertJsoncppStringToData(_response);
     }
     catch (std::exception const& _ex)
     {
@@ -70,44 +58,148 @@ TestRawTransaction ToolChainManager::test_rawTransaction(
             (*errObj)["error"] = outErrorContent;
             (*res).addSubObject(errObj);
             ETH_DC_MESSAGE(DC::RPC, "T9N Response reconstructed:\n" + res->asJson());
-            errorCaught = true;
+            _errorCaught = true;
         }
         else
             throw _ex;
     }
+    return res;
+}
+
+// Prepare test_rawTransaction response structure from t9n result of the transaction
+spDataObject makeResponse(DataObject const& _resTr, BYTES const& _rlp, bool _rejected)
+{
+    spDataObject out;
+    (*out)["result"] = true;
 
     string const hash = "0x" + dev::toString(dev::sha3(fromHex(_rlp.asString())));
     spDataObject tr;
 
-    auto const& resTr = res->getSubObjects().at(0);
-    if (resTr->count("intrinsicGas"))
+    if (_resTr.count("intrinsicGas"))
     {
-        if (resTr->atKey("intrinsicGas").type() == DataType::Integer)
-            (*tr)["intrinsicGas"] = VALUE(resTr->atKey("intrinsicGas").asInt()).asString();
-        else if (resTr->atKey("intrinsicGas").type() == DataType::String)
-            (*tr)["intrinsicGas"] = VALUE(resTr->atKey("intrinsicGas").asString()).asString();
+        if (_resTr.atKey("intrinsicGas").type() == DataType::Integer)
+            (*tr)["intrinsicGas"] = VALUE(_resTr.atKey("intrinsicGas").asInt()).asString();
+        else if (_resTr.atKey("intrinsicGas").type() == DataType::String)
+            (*tr)["intrinsicGas"] = VALUE(_resTr.atKey("intrinsicGas").asString()).asString();
         else
-            ETH_ERROR_MESSAGE("`intrinsicGas` field type expected to be Int or String: `" + resTr->asJson());
+            ETH_ERROR_MESSAGE("`intrinsicGas` field type expected to be Int or String: `" + _resTr.asJson());
     }
     else
         (*tr)["intrinsicGas"] = "0x00";
 
-    if (response.find("error") != string::npos || response.find("ERROR") != string::npos || errorCaught)
+    if (_rejected)
     {
-        (*tr)["error"] = resTr->atKey("error").asString();
+        (*tr)["error"] = _resTr.atKey("error").asString();
         (*tr)["sender"] = FH20::zero().asString();
         (*tr)["hash"] = hash;
-        out["rejectedTransactions"].addArrayObject(tr);
+        (*out)["rejectedTransactions"].addArrayObject(tr);
     }
     else
     {
-        (*tr)["sender"] = resTr->atKey("address").asString();
-        (*tr)["hash"] = resTr->atKey("hash").asString();
-        out["acceptedTransactions"].addArrayObject(tr);
+        (*tr)["sender"] = _resTr.atKey("address").asString();
+        (*tr)["hash"] = _resTr.atKey("hash").asString();
+        (*out)["acceptedTransactions"].addArrayObject(tr);
         if (tr->atKey("hash").asString() != hash)
             ETH_ERROR_MESSAGE("t8n tool returned different tx.hash than retesteth: (t8n.hash != retesteth.hash) " + tr->atKey("hash").asString() + " != " + hash);
     }
 
-    ETH_DC_MESSAGE(DC::RPC, "Response: test_rawTransaction `" + out.asJson());
-    return TestRawTransaction(out);
+    ETH_DC_MESSAGE(DC::RPC, "Response: test_rawTransaction `" + out->asJson());
+    return out;
+}
+
+spDataObject rawTransaction(BYTES const& _rlp, FORK const& _fork, fs::path const& _toolPath, fs::path const& _tmpDir)
+{
+    // Rlp list header builder for given data
+    test::RLPStreamU txsout(1);
+    if (_rlp.firstByte() < 128)
+    {
+        // wrap typed transactions as RLPstring in RLPStream
+        txsout.appendString(_rlp.asString());
+    }
+    else
+        txsout.appendRaw(_rlp.asString());
+
+    // Write data with memory allocation but faster
+    string response;
+    bool errorCaught;
+    string const txs = string("\"") + txsout.outHeader() + _rlp.asString().substr(2) + "\"";
+    spDataObject const res = runT9n(txs, _fork, _toolPath, _tmpDir, response, errorCaught);
+
+    bool const rejected = response.find("error") != string::npos || response.find("ERROR") != string::npos || errorCaught;
+    return makeResponse(res->getSubObjects().at(0), _rlp, rejected);
+}
+
+// Typed transactions are wrapped as rlp strings, legacy ones must be exactly one valid rlp item
+// Otherwise the transaction could shift the other transactions of the list
+bool canBatch(BYTES const& _rlp)
+{
+    if (_rlp.firstByte() < 128)
+        return true;
+    try
+    {
+        bytes const data = fromHex(_rlp.asString());
+        dev::RLP const rlp(data, dev::RLP::VeryStrict);
+        return rlp.actualSize() == data.size();
+    }
+    catch (std::exception const&)
+    {
+        return false;
+    }
+}
+}  // namespace
+
+TestRawTransaction ToolChainManager::test_rawTransaction(
+    BYTES const& _rlp, FORK const& _fork, fs::path const& _toolPath, fs::path const& _tmpDir)
+{
+    return TestRawTransaction(rawTransaction(_rlp, _fork, _toolPath, _tmpDir));
+}
+
+std::vector<TestRawTransaction> ToolChainManager::test_rawTransactions(
+    std::vector<BYTES> const& _rlps, FORK const& _fork, fs::path const& _toolPath, fs::path const& _tmpDir)
+{
+    std::vector<spDataObject> responses(_rlps.size(), spDataObject(0));
+    std::vector<size_t> batch;
+    for (size_t i = 0; i < _rlps.size(); i++)
+        if (canBatch(_rlps.at(i)))
+            batch.emplace_back(i);
+
+    if (batch.size() > 1)
+    {
+        dev::RLPStream txsout(batch.size());
+        for (size_t i : batch)
+        {
+            bytes const data = fromHex(_rlps.at(i).asString());
+            if (_rlps.at(i).firstByte() < 128)
+                txsout.append(data);
+            else
+                txsout.appendRaw(data);
+        }
+
+        string response;
+        bool errorCaught;
+        string const txs = "\"0x" + toHex(txsout.out()) + "\"";
+        spDataObject const res = runT9n(txs, _fork, _toolPath, _tmpDir, response, errorCaught);
+
+        // If t9n failed on the list, transactions are run one by one
+        if (!errorCaught && res->type() == DataType::Array && res->getSubObjects().size() == batch.size())
+        {
+            for (size_t j = 0; j < batch.size(); j++)
+            {
+                DataObject const& resTr = res->getSubObjects().at(j);
+                responses.at(batch.at(j)) = makeResponse(resTr, _rlps.at(batch.at(j)), resTr.count("error"));
+            }
+        }
+        else
+            ETH_DC_MESSAGE(DC::RPC, "T9N could not process the transaction list, run transactions one by one");
+    }
+
+    std::vector<TestRawTransaction> results;
+    results.reserve(_rlps.size());
+    for (size_t i = 0; i < _rlps.size(); i++)
+    {
+        if (responses.at(i).isEmpty())
+            responses.at(i) = rawTransaction(_rlps.at(i), _fork, _toolPath, _tmpDir);
+        results.emplace_back(TestRawTransaction(responses.at(i)));
+    }
+    return results;
 }
@@ -164,6 +164,19 @@ ToolResponse ToolChain::mineBlockOnTool(
     return toolMiner.readResult();
 }
 
+std::string const& ToolChain::allocJson(spState const& _state) const
+{
+    // Block states are immutable and shared between blocks, rewinds and reorgs
+    if (m_allocCacheState.isEmpty() || &m_allocCacheState.getCContent() != &_state.getCContent())
+    {
+        m_allocCacheContent = _state->asDataObject()->asJsonNoFirstKey();
+        m_allocCacheState = _state;
+    }
+    else
+        ETH_DC_MESSAGE(DC::LOWLOG, "ToolChain::allocJson reuse serialized state");
+    return m_allocCacheContent;
+}
+
 void ToolChain::rewindToBlock(size_t _number)
 {
     while (m_blocks.size() > _number + 1)
@@ -69,6 +69,10 @@ public:
     void insertBlock(EthereumBlockState const& _block) { m_blocks.emplace_back(_block); }
     boost::filesystem::path const& tmpDir() const { return m_tmpDir; }
 
+    // Serialized t8ntool alloc of _state. The genesis state is exported for every
+    // transaction of a state test after rewinding to block 0, so keep the last one
+    std::string const& allocJson(spState const& _state) const;
+
 private:
     ToolChain(){};
     // Execute t8ntool cmd with input _block information, and get the output block information
@@ -83,6 +87,8 @@ private:
     spFORK m_fork;
     boost::filesystem::path m_toolPath;
     boost::filesystem::path m_tmpDir;
+    mutable spState m_allocCacheState;
+    mutable std::string m_allocCacheContent;
 
 private:
     void checkDifficultyAgainstRetesteth(VALUE const& _toolDifficulty, spBlockHeader const& _pendingHeader);
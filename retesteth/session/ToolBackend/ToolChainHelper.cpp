@@ -171,31 +171,6 @@ VALUE calculateGasLimit(VALUE const& _parentGasLimit, VALUE const& _parentGasUse
             gasFloorTarget, gasLimit - gasLimit / boundDivisor + 1 + (_parentGasUsed.asBigInt() * 6 / 5) / boundDivisor);
 }
 
-// Because tool report incomplete state. restore missing fields with zeros
-// Also remove leading zeros in storage
-spState restoreFullState(DataObject& _toolState)
-{
-    spDataObject fullState;
-    for (auto& accTool2 : _toolState.getSubObjectsUnsafe())
-    {
-        DataObject& accTool = accTool2.getContent();
-        DataObject& acc = fullState.getContent()[accTool.getKey()];
-        acc[c_balance] = accTool.count(c_balance) ? accTool.atKey(c_balance).asString() : "0x00";
-        acc[c_nonce] = accTool.count(c_nonce) ? accTool.atKey(c_nonce).asString() : "0x00";
-        acc[c_code] = accTool.count(c_code) ? accTool.atKey(c_code).asString() : "0x";
-        if (accTool.count(c_storage))
-            acc.atKeyPointer(c_storage) = accTool.atKeyPointerUnsafe(c_storage);
-        else
-            acc.atKeyPointer(c_storage) = sDataObject(DataType::Object);
-        for (auto& storageRecord : acc.atKeyUnsafe(c_storage).getSubObjectsUnsafe())
-        {
-            storageRecord.getContent().performModifier(mod_removeLeadingZerosFromHexValueEVEN);
-            storageRecord.getContent().performModifier(mod_removeLeadingZerosFromHexKeyEVEN);
-        }
-    }
-    return spState(new State(dataobject::move(fullState)));
-}
-
 ChainOperationParams ChainOperationParams::defaultParams(ToolParams const& _params)
 {
     ChainOperationParams aleth;
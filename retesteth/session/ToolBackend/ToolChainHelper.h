@@ -23,6 +23,5 @@ VALUE calculateGasLimit(VALUE const& _parentGasLimit, VALUE const& _parentGasUse
 VALUE calculateEthashDifficulty(
     ChainOperationParams const& _chainParams, BlockHeader const& _bi, BlockHeader const& _parent);
 VALUE calculateEIP1559BaseFee(ChainOperationParams const& _chainParams, spBlockHeader const& _bi, spBlockHeader const& _parent);
-spState restoreFullState(DataObject& _toolState);
 
 }  // namespace toolimpl
@@ -35,10 +35,14 @@ public:
     // Transaction tests
     static TestRawTransaction test_rawTransaction(
         BYTES const& _rlp, FORK const& _fork, boost::filesystem::path const& _toolPath, boost::filesystem::path const& _tmpDir);
+    static std::vector<TestRawTransaction> test_rawTransactions(std::vector<BYTES> const& _rlps, FORK const& _fork,
+        boost::filesystem::path const& _toolPath, boost::filesystem::path const& _tmpDir);
 
     // EOF tests
     static std::string test_rawEOFCode(
         BYTES const& _code, FORK const& _fork, boost::filesystem::path const& _toolPath, boost::filesystem::path const& _tmpDir);
+    static std::vector<std::string> test_rawEOFCodes(std::vector<BYTES> const& _codes, FORK const& _fork,
+        boost::filesystem::path const& _toolPath, boost::filesystem::path const& _tmpDir);
 
     // Difficulty tests
     static VALUE test_calculateDifficulty(FORK const& _fork, VALUE const& _blockNumber, VALUE const& _parentTimestamp,
@@ -0,0 +1,204 @@
+#include "ToolStateReader.h"
+#include <retesteth/Constants.h>
+#include <retesteth/EthChecks.h>
+
+using namespace std;
+using namespace dev;
+using namespace test;
+using namespace test::teststruct;
+using namespace test::teststruct::constnames;
+
+namespace
+{
+// Reads the json of t8ntool alloc without building a DataObject tree
+class AllocReader
+{
+public:
+    AllocReader(string const& _input) : m_input(_input) {}
+
+    // Call _onField(key) for each field of an object, the value must be consumed by _onField
+    template <class F>
+    void readObject(F const& _onField)
+    {
+        expect('{');
+        if (peek() == '}')
+        {
+            m_pos++;
+            return;
+        }
+        while (true)
+        {
+            string const key = readString();
+            expect(':');
+            _onField(key);
+            char const c = next();
+            if (c == '}')
+                return;
+            if (c != ',')
+                error("expected ',' or '}'");
+        }
+    }
+
+    string readString()
+    {
+        expect('"');
+        size_t const begin = m_pos;
+        while (m_pos < m_input.size() && m_input[m_pos] != '"')
+            m_pos += (m_input[m_pos] == '\\') ? 2 : 1;
+        if (m_pos >= m_input.size())
+            error("unterminated string");
+        return m_input.substr(begin, m_pos++ - begin);
+    }
+
+    void skipValue()
+    {
+        char const c = peek();
+        if (c == '"')
+            readString();
+        else if (c == '{')
+            readObject([this](string const&) { skipValue(); });
+        else if (c == '[')
+        {
+            m_pos++;
+            if (peek() == ']')
+            {
+                m_pos++;
+                return;
+            }
+            do
+                skipValue();
+            while (next() == ',');
+            if (m_input[m_pos - 1] != ']')
+                error("expected ']'");
+        }
+        else
+        {
+            while (m_pos < m_input.size() && !isDelimiter(m_input[m_pos]))
+                m_pos++;
+        }
+    }
+
+    void expectEnd()
+    {
+        skipSpaces();
+        if (m_pos != m_input.size())
+            error("expected end of json");
+    }
+
+private:
+    static bool isSpace(char _c) { return _c == ' ' || _c == '\n' || _c == '\r' || _c == '\t'; }
+    static bool isDelimiter(char _c) { return isSpace(_c) || _c == ',' || _c == '}' || _c == ']'; }
+    void skipSpaces()
+    {
+        while (m_pos < m_input.size() && isSpace(m_input[m_pos]))
+            m_pos++;
+    }
+    char peek()
+    {
+        skipSpaces();
+        if (m_pos >= m_input.size())
+            error("unexpected end of json");
+        return m_input[m_pos];
+    }
+    char next()
+    {
+        char const c = peek();
+        m_pos++;
+        return c;
+    }
+    void expect(char _c)
+    {
+        if (next() != _c)
+            error(string("expected '") + _c + "'");
+    }
+    [[noreturn]] void error(string const& _what) const
+    {
+        throw UpwardsException("Tool alloc parse error: " + _what + " at " + to_string(m_pos) + ": `" +
+                               m_input.substr(m_pos > 50 ? m_pos - 50 : 0, 100) + "`");
+    }
+
+    string const& m_input;
+    size_t m_pos = 0;
+};
+
+// Tool could keep leading zeros, the value must still be a prefixed hex of u256
+spVALUE readNumber(string const& _hex, string const& _hint)
+{
+    if (_hex.empty() || _hex == "0x")
+        return spVALUE(new VALUE(0));
+    if (_hex.size() < 3 || _hex[0] != '0' || _hex[1] != 'x')
+        throw UpwardsException("Tool alloc parse error: " + _hint + " is not prefixed hex `" + _hex + "`");
+    size_t const begin = _hex.find_first_not_of('0', 2);
+    if (_hex.find_first_not_of("0123456789abcdefABCDEF", 2) != string::npos)
+        throw UpwardsException("Tool alloc parse error: " + _hint + " is not a hex `" + _hex + "`");
+    if (begin != string::npos && _hex.size() - begin > 64)
+        throw UpwardsException("Tool alloc parse error: " + _hint + " >u256 `" + _hex + "`");
+    return spVALUE(new VALUE(bigint(_hex)));
+}
+
+bool sameAccount(AccountBase const& _acc, AccountBase const& _preAcc)
+{
+    if (_acc.balance() != _preAcc.balance() || _acc.nonce() != _preAcc.nonce() || _acc.code() != _preAcc.code())
+        return false;
+    auto const& storage = _acc.storage().getKeys();
+    auto const& preStorage = _preAcc.storage().getKeys();
+    if (storage.size() != preStorage.size())
+        return false;
+    for (auto const& [key, record] : storage)
+    {
+        auto const preRecord = preStorage.find(key);
+        if (preRecord == preStorage.end() || std::get<1>(preRecord->second).getCContent() != std::get<1>(record))
+            return false;
+    }
+    return true;
+}
+}  // namespace
+
+namespace toolimpl
+{
+spState readToolState(string const& _alloc, spState const& _preState)
+{
+    std::map<FH20, spAccountBase> accounts;
+    AllocReader reader(_alloc);
+    try
+    {
+        reader.readObject([&](string const& _address) {
+            spVALUE balance(new VALUE(0));
+            spVALUE nonce(new VALUE(0));
+            spBYTES code(new BYTES(string("0x")));
+            spStorage storage(new Storage());
+            reader.readObject([&](string const& _field) {
+                if (_field == c_balance)
+                    balance = readNumber(reader.readString(), _address + " balance");
+                else if (_field == c_nonce)
+                    nonce = readNumber(reader.readString(), _address + " nonce");
+                else if (_field == c_code)
+                    code = spBYTES(new BYTES(reader.readString()));
+                else if (_field == c_storage)
+                    reader.readObject([&](string const& _key) {
+                        spVALUE key = readNumber(_key, _address + " storage key");
+                        storage.getContent().addRecord(key, readNumber(reader.readString(), _address + " storage[" + _key + "]"));
+                    });
+                else
+                    reader.skipValue();
+            });
+
+            // Keep the account object of the previous block if the tool did not change it
+            FH20 const address(_address);
+            spAccountBase account(new State::Account(address, balance, nonce, code, storage));
+            auto const preAcc = _preState->accounts().find(address);
+            if (preAcc != _preState->accounts().end() && sameAccount(account, preAcc->second))
+                accounts.emplace(address, preAcc->second);
+            else
+                accounts.emplace(address, account);
+        });
+        reader.expectEnd();
+    }
+    catch (std::runtime_error const& _ex)
+    {
+        throw UpwardsException(string("Tool alloc parse error: ") + _ex.what());
+    }
+    return spState(new State(accounts));
+}
+
+}  // namespace toolimpl
@@ -0,0 +1,15 @@
+#pragma once
+#include <retesteth/testStructures/types/Ethereum/State.h>
+#include <string>
+
+namespace toolimpl
+{
+using namespace test::teststruct;
+
+// Decode t8ntool output alloc directly into State accounts
+// Because tool report incomplete state, missing fields are restored with zeros
+// Storage keys and values are read as numbers, which removes leading zeros
+// Accounts unchanged since _preState share their objects with it
+spState readToolState(std::string const& _alloc, spState const& _preState);
+
+}  // namespace toolimpl
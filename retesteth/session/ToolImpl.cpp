@@ -331,6 +331,19 @@ TestRawTransaction ToolImpl::test_rawTransaction(BYTES const& _rlp, FORK const&
     return TestRawTransaction(DataObject());
 }
 
+std::vector<TestRawTransaction> ToolImpl::test_rawTransactions(std::vector<BYTES> const& _rlps, FORK const& _fork)
+{
+    auto const& genesisSetupInTool = Options::getCurrentConfig().getGenesisTemplate(_fork);
+    FORK t8nForkName(genesisSetupInTool.getCContent().atKey("params").atKey("fork").asString());
+
+    rpcCall("", {});
+    TRYCATCHCALL(
+        ETH_DC_MESSAGE(DC::RPC, "\nRequest: test_rawTransactions '" + test::fto_string(_rlps.size()) + "' transactions, Fork: `" + t8nForkName.asString());
+        return ToolChainManager::test_rawTransactions(_rlps, t8nForkName, m_toolPath, m_tmpDir);
+        , "test_rawTransactions", CallType::FAILEVERYTHING, DC::RPC)
+    return std::vector<TestRawTransaction>();
+}
+
 std::string ToolImpl::test_rawEOFCode(BYTES const& _code, FORK const& _fork)
 {
     auto const& genesisSetupInTool = Options::getCurrentConfig().getGenesisTemplate(_fork);
@@ -345,6 +358,19 @@ std::string ToolImpl::test_rawEOFCode(BYTES const& _code, FORK const& _fork)
     return string();
 }
 
+std::vector<std::string> ToolImpl::test_rawEOFCodes(std::vector<BYTES> const& _codes, FORK const& _fork)
+{
+    auto const& genesisSetupInTool = Options::getCurrentConfig().getGenesisTemplate(_fork);
+    FORK t8nForkName(genesisSetupInTool.getCContent().atKey("params").atKey("fork").asString());
+
+    rpcCall("", {});
+    TRYCATCHCALL(
+        ETH_DC_MESSAGE(DC::RPC, "\nRequest: test_rawEOFCodes '" + test::fto_string(_codes.size()) + "' codes, Fork: `" + t8nForkName.asString());
+        return ToolChainManager::test_rawEOFCodes(_codes, t8nForkName, m_toolPath, m_tmpDir);
+        , "test_rawEOFCodes", CallType::DONTFAILONUPWARDS, DC::RPC)
+    return std::vector<std::string>();
+}
+
 void ToolImpl::test_registerWithdrawal(BYTES const& _rlp)
 {
     rpcCall("", {});
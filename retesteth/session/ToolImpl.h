@@ -50,7 +50,9 @@ public:
     void test_registerWithdrawal(BYTES const& _rlp) override;
     FH32 test_getLogHash(FH32 const& _txHash) override;
     TestRawTransaction test_rawTransaction(BYTES const& _rlp, FORK const& _fork) override;
+    std::vector<TestRawTransaction> test_rawTransactions(std::vector<BYTES> const& _rlps, FORK const& _fork) override;
     std::string test_rawEOFCode(BYTES const& _code, FORK const& _fork) override;
+    std::vector<std::string> test_rawEOFCodes(std::vector<BYTES> const& _codes, FORK const& _fork) override;
     VALUE test_calculateDifficulty(FORK const& _fork, VALUE const& _blockNumber, VALUE const& _parentTimestamp,
         VALUE const& _parentDifficulty, VALUE const& _currentTimestamp, VALUE const& _uncleNumber) override;
 
@@ -415,6 +415,47 @@ void convertDecTransactionToHex(spDataObject& _data)
     data[c_to].performModifier(mod_valueToLowerCase);
 }
 
+std::pair<string, string> splitDataLabel(string const& _data)
+{
+    static std::string const c_labelPrefix = ":label";
+    size_t const pos = _data.find(c_labelPrefix);
+    if (pos == string::npos)
+        return {string(), _data};
+    size_t const posEnd = _data.find(' ', pos + c_labelPrefix.size() + 1);
+    if (posEnd == string::npos)
+        return {_data.substr(pos), string()};
+    return {_data.substr(pos, posEnd - pos), _data.substr(posEnd + 1)};
+}
+
+std::vector<string> collectFillerCode(DataObject const& _test)
+{
+    std::vector<string> codes;
+    auto addString = [&codes](DataObject const& _el) {
+        if (_el.type() == DataType::String)
+            codes.emplace_back(_el.asString());
+    };
+    auto addTransactionData = [&codes](DataObject const& _data) {
+        DataObject const& data = (_data.type() == DataType::Object && _data.count(c_data)) ? _data.atKey(c_data) : _data;
+        if (data.type() == DataType::String)
+            codes.emplace_back(splitDataLabel(data.asString()).second);
+    };
+
+    if (_test.count("pre"))
+        for (auto const& acc : _test.atKey("pre").getSubObjects())
+            if (acc->type() == DataType::Object && acc->count(c_code))
+                addString(acc->atKey(c_code));
+    if (_test.count("transaction") && _test.atKey("transaction").count(c_data))
+        for (auto const& data : _test.atKey("transaction").atKey(c_data).getSubObjects())
+            addTransactionData(data);
+    if (_test.count("blocks"))
+        for (auto const& block : _test.atKey("blocks").getSubObjects())
+            if (block->type() == DataType::Object && block->count("transactions"))
+                for (auto const& tr : block->atKey("transactions").getSubObjects())
+                    if (tr->type() == DataType::Object && tr->count(c_data))
+                        addString(tr->atKey(c_data));
+    return codes;
+}
+
 bool src_findBigInt(DataObject const& el)
 {
     if (el.type() == DataType::String && el.asString().find(C_BIGINT_PREFIX) != string::npos)
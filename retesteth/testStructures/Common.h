@@ -59,6 +59,12 @@ void convertDecStateToHex(spDataObject& _data,
 
 void convertDecTransactionToHex(spDataObject& _data);
 
+// Split transaction data `:label name code` into the label and the code
+std::pair<std::string, std::string> splitDataLabel(std::string const& _data);
+
+// Source code of pre accounts and transactions of a filler test, for test::compiler::PrecompiledCode
+std::vector<std::string> collectFillerCode(DataObject const& _test);
+
 // Convert dec fields to hex, add 0x prefix to accounts and storage keys
 spDataObject convertDecBlockheaderIncompleteToHex(DataObject const& _data);
 
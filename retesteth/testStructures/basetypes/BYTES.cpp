@@ -7,9 +7,12 @@ using namespace std;
 
 namespace
 {
+// Lower the hex digits after the 0x prefix in place
 void toLowerHexStr(string& _input)
 {
-    std::transform(_input.begin(), _input.end(), _input.begin(), [](unsigned char c) {
+    if (_input.size() < 2)
+        return;
+    std::transform(_input.begin() + 2, _input.end(), _input.begin() + 2, [](unsigned char c) {
         if (!isxdigit(c))
             ETH_ERROR_MESSAGE("BYTES string has char which is not hex: `" + string(1, c) + "`\n");
         return std::tolower(c);
@@ -34,9 +37,8 @@ BYTES::BYTES(DataObject const& _data)
     string const& v = _data.asString();
     if (v.size() < 2 || v[0] != '0' || v[1] != 'x')
         ETH_ERROR_MESSAGE("Key `" + k + "` is not BYTES `" + v + "`");
-    m_data = v.substr(2);
+    m_data = v;
     toLowerHexStr(m_data);
-    m_data = "0x" + m_data;
 }
 
 BYTES::BYTES(string const& _data)
@@ -44,9 +46,8 @@ BYTES::BYTES(string const& _data)
     string const& v = _data;
     if (v.size() < 2 || v[0] != '0' || v[1] != 'x')
         ETH_ERROR_MESSAGE("Bytes are not BYTES `" + v + "`");
-    m_data = v.substr(2);
+    m_data = v;
     toLowerHexStr(m_data);
-    m_data = "0x" + m_data;
 }
 
 size_t BYTES::firstByte() const
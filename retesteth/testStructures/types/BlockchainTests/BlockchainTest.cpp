@@ -1,9 +1,9 @@
 #include "BlockchainTest.h"
 #include <retesteth/EthChecks.h>
+#include <retesteth/helpers/CompressedFile.h>
 #include <retesteth/helpers/TestOutputHelper.h>
 #include <retesteth/testStructures/Common.h>
 #include <retesteth/Constants.h>
-#include <boost/test/framework.hpp>
 
 using namespace std;
 using namespace test::teststruct;
@@ -122,11 +122,11 @@ void BlockchainTest::registerAllVectors() const
 {
     string execTotal;
     auto const& helper = TestOutputHelper::get();
-    string const suite = boost::unit_test::framework::current_test_case().full_name();
+    string const suite = TestInfo::caseFullName();
     string const execPrefix = string("-t ") + suite + " --";
     for (auto const& test : m_tests)
     {
-        auto const filename = helper.testFile().stem().string();
+        auto const filename = testFileStem(helper.testFile());
         const string exec = string(" --singletest ") + filename + "/" + test.testName() + "\n";
         execTotal += execPrefix + exec;
     }
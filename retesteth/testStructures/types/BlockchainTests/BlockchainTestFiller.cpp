@@ -22,6 +22,9 @@ BlockchainTestInFiller::BlockchainTestInFiller(spDataObject& _data)
                 {"pre", {{DataType::Object}, jsonField::Required}},
                 {"blocks", {{DataType::Array}, jsonField::Required}}});
 
+        // Run the compilers of all test sources at once
+        test::compiler::PrecompiledCode const precompiled(collectFillerCode(_data));
+
         m_hasAtLeastOneUncle = false;
         m_name = _data->getKey();
         if (_data->count("_info"))
@@ -1,3 +1,4 @@
+#include <retesteth/helpers/CompressedFile.h>
 #include <retesteth/helpers/TestOutputHelper.h>
 #include <retesteth/testStructures/Common.h>
 #include "EthChecks.h"
@@ -82,10 +83,10 @@ void DifficultyTest::registerAllVectors() const
 {
     string execTotal;
     auto const& helper = TestOutputHelper::get();
-    string const suite = boost::unit_test::framework::current_test_case().full_name();
+    string const suite = TestInfo::caseFullName();
     string const execPrefix = string("-t ") + suite + " --";
 
-    auto const filename = helper.testFile().stem().string();
+    auto const filename = testFileStem(helper.testFile());
     const string exec = string(" --singletest ") + filename + "\n";
     execTotal += execPrefix + exec;
 
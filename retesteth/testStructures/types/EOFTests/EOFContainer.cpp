@@ -0,0 +1,116 @@
+#include "EOFContainer.h"
+#include <vector>
+using namespace std;
+using namespace dev;
+
+namespace
+{
+uint8_t const c_magic[] = {0xef, 0x00};
+uint8_t const c_version = 0x01;
+uint8_t const c_terminator = 0x00;
+uint8_t const c_typeSection = 0x01;
+uint8_t const c_codeSection = 0x02;
+uint8_t const c_dataSection = 0x03;
+size_t const c_codeSectionLimit = 1024;
+size_t const c_typeEntrySize = 4;
+
+string sectionMissing(uint8_t _expectedSection)
+{
+    switch (_expectedSection)
+    {
+    case c_typeSection: return "EOF_TypeSectionMissing";
+    case c_codeSection: return "EOF_CodeSectionMissing";
+    case c_dataSection: return "EOF_DataSectionMissing";
+    default: return "EOF_HeaderTerminatorMissing";
+    }
+}
+
+size_t readUint16(bytes const& _code, size_t _pos)
+{
+    return (size_t(_code.at(_pos)) << 8) | _code.at(_pos + 1);
+}
+}  // namespace
+
+namespace test::teststruct
+{
+string validateEOFHeader(bytes const& _code)
+{
+    if (_code.size() < 2 || _code.at(0) != c_magic[0] || _code.at(1) != c_magic[1])
+        return "EOF_InvalidPrefix";
+    if (_code.size() < 3 || _code.at(2) != c_version)
+        return "EOF_UnknownVersion";
+
+    size_t typeSize = 0;
+    size_t dataSize = 0;
+    std::vector<size_t> codeSizes;
+    uint8_t expected = c_typeSection;
+    bool terminated = false;
+    size_t pos = 3;
+    while (pos < _code.size())
+    {
+        uint8_t const section = _code.at(pos++);
+        if (section == c_terminator)
+        {
+            if (expected != c_terminator)
+                return sectionMissing(expected);
+            terminated = true;
+            break;
+        }
+        if (section != expected)
+            return sectionMissing(expected);
+
+        if (section == c_codeSection)
+        {
+            if (pos + 1 >= _code.size())
+                return "EOF_IncompleteSectionNumber";
+            size_t const num = readUint16(_code, pos);
+            pos += 2;
+            if (num == 0)
+                return "EOF_ZeroSectionSize";
+            for (size_t i = 0; i < num; i++)
+            {
+                if (pos + 1 >= _code.size())
+                    return "EOF_IncompleteSectionSize";
+                size_t const size = readUint16(_code, pos);
+                pos += 2;
+                if (size == 0)
+                    return "EOF_ZeroSectionSize";
+                codeSizes.emplace_back(size);
+            }
+            expected = c_dataSection;
+        }
+        else
+        {
+            if (pos + 1 >= _code.size())
+                return "EOF_IncompleteSectionSize";
+            size_t const size = readUint16(_code, pos);
+            pos += 2;
+            if (section == c_typeSection)
+            {
+                if (size == 0)
+                    return "EOF_ZeroSectionSize";
+                typeSize = size;
+                expected = c_codeSection;
+            }
+            else
+            {
+                dataSize = size;
+                expected = c_terminator;
+            }
+        }
+    }
+    if (!terminated)
+        return "EOF_SectionHeadersNotTerminated";
+
+    size_t bodiesSize = typeSize + dataSize;
+    for (size_t size : codeSizes)
+        bodiesSize += size;
+    if (bodiesSize != _code.size() - pos)
+        return "EOF_InvalidSectionBodiesSize";
+    if (typeSize != codeSizes.size() * c_typeEntrySize)
+        return "EOF_InvalidTypeSectionSize";
+    if (codeSizes.size() > c_codeSectionLimit)
+        return "EOF_TooManyCodeSections";
+    return string();
+}
+}  // namespace teststruct
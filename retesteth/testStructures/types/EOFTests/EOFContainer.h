@@ -0,0 +1,14 @@
+#pragma once
+#include <libdevcore/Common.h>
+#include <string>
+
+namespace test::teststruct
+{
+
+/// Structural check of EOF v1 container header (EIP-3540, EIP-4750)
+/// magic, version, section headers and section sizes. Code section contents are not validated
+/// Returns the exception name of the first header error in the order clients report them,
+/// empty string if the header is valid and the code has to be validated by the client
+std::string validateEOFHeader(dev::bytes const& _code);
+
+}  // namespace teststruct
@@ -9,30 +9,27 @@ State::State(std::map<FH20, spAccountBase>& _accList)
 {
     // We certain that account provided for the state is full and not incomplete
     m_accounts = _accList;
-    m_raw = spDataObject();
     for (auto const& el : _accList)
-    {
         ETH_ERROR_REQUIRE_MESSAGE(el.second->type() == AccountType::FullAccount, "State::State(std::map) provided account type is not of a FullAccount type!");
-        (*m_raw).atKeyPointer(el.first.asString()) = el.second->asDataObject();  // Recreate export data
-    }
 }
 
 State::State(spDataObjectMove _data)
 {
     try
     {
-        m_raw = _data.getPointer();
-        for (auto& el : (*m_raw).getSubObjectsUnsafe())
+        m_export->raw = _data.getPointer();
+        m_export->built = true;
+        for (auto& el : (*m_export->raw).getSubObjectsUnsafe())
         {
             FH20 key(el->getKey());
             m_accounts[key] = spAccountBase(new Account(el));
         }
-        if (m_raw->type() != DataType::Object)
+        if (m_export->raw->type() != DataType::Object)
             ETH_ERROR_MESSAGE("State must be initialized from json type `Object`!");
     }
     catch (std::exception const& _ex)
     {
-        throw UpwardsException(string("State parse error: ") + _ex.what() + m_raw->asJson());
+        throw UpwardsException(string("State parse error: ") + _ex.what() + m_export->raw->asJson());
     }
 }
 
@@ -56,7 +53,17 @@ spDataObject const& State::asDataObject() const
 {
     // As long as we guarantee unmutability of parsed data in the structure
     // We can return the same data object as we got, not recalculating the whole thing
-    return m_raw;
+    // Accounts are shared with the states of other blocks, so their export data is built under one lock
+    static std::mutex accountsMutex;
+    std::lock_guard<std::mutex> lock(m_export->mutex);
+    if (!m_export->built)
+    {
+        std::lock_guard<std::mutex> accountsLock(accountsMutex);
+        for (auto const& el : m_accounts)
+            (*m_export->raw).atKeyPointer(el.first.asString()) = el.second->asDataObject();
+        m_export->built = true;
+    }
+    return m_export->raw;
 }
 
 }  // namespace teststruct
@@ -1,6 +1,8 @@
 #pragma once
 #include "Base/StateBase.h"
 #include <libdataobj/DataObject.h>
+#include <memory>
+#include <mutex>
 
 namespace test::teststruct
 {
@@ -27,7 +29,14 @@ public:
     spDataObject const& asDataObject() const override;
 
 private:
-    spDataObject m_raw;
+    // Export data is built on the first asDataObject() call and shared by the copies of the state
+    struct ExportData
+    {
+        std::mutex mutex;
+        bool built = false;
+        spDataObject raw;
+    };
+    std::shared_ptr<ExportData> m_export = std::make_shared<ExportData>();
     State() {}
 
 public:
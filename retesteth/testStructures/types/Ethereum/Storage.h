@@ -10,6 +10,7 @@ namespace teststruct
 struct Storage : GCP_SPointerBase
 {
     Storage(DataObject const&);
+    Storage() {}
     typedef std::tuple<spVALUE, spVALUE> StorageRecord;
 
     std::map<std::string, StorageRecord> const& getKeys() const { return m_map; }
@@ -21,6 +22,7 @@ struct Storage : GCP_SPointerBase
     }
     spDataObject asDataObject() const;
     void merge(Storage const& _storage);
+    void addRecord(spVALUE const& _key, spVALUE const& _value) { m_map[_key->asString()] = {_key, _value}; }
 
 private:
     std::map<std::string, StorageRecord> m_map;
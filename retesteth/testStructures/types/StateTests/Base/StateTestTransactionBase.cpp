@@ -2,6 +2,7 @@
 #include <retesteth/EthChecks.h>
 #include <retesteth/ExitHandler.h>
 #include <retesteth/Constants.h>
+#include <retesteth/helpers/TraceSpan.h>
 
 using namespace std;
 using namespace dataobject;
@@ -18,6 +19,7 @@ spDataObject StateTestTransactionBase::asDataObject() const
 /// Construct individual transactions from gstate test transaction
 std::vector<TransactionInGeneralSection> StateTestTransactionBase::buildTransactions() const
 {
+    ETH_TRACE_SPAN("buildTransactions");
     // Construct vector of all transactions that are described int data
     std::vector<TransactionInGeneralSection> out;
     out.reserve(m_databox.size() * m_gasLimit.size() * m_value.size());
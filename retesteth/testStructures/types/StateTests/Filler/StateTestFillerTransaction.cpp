@@ -110,24 +110,7 @@ StateTestFillerTransaction::StateTestFillerTransaction(spDataObjectMove _data)
 
             // -- Compile LLL in transaction data into byte code if not already
             // Detect :label prefix over code compilation
-            string label;
-            string rawData = actualDataField->asString();
-            std::string const c_labelPrefix = ":label";
-            if (rawData.find(c_labelPrefix) != string::npos)
-            {
-                size_t const pos = rawData.find(c_labelPrefix);
-                size_t const posEnd = rawData.find(' ', pos + c_labelPrefix.size() + 1);
-                if (posEnd != string::npos)
-                {
-                    label = rawData.substr(pos, posEnd - pos);
-                    rawData = rawData.substr(posEnd + 1);  // remove label before code parsing
-                }
-                else
-                {
-                    label = rawData.substr(pos);
-                    rawData = "";
-                }
-            }
+            auto const [label, rawData] = splitDataLabel(actualDataField->asString());
             (*actualDataField).setString(test::compiler::replaceCode(rawData));
             // ---
             m_databox.emplace_back(Databox(BYTES(actualDataField.getContent()), label, rawData.substr(0, 30), accessList));
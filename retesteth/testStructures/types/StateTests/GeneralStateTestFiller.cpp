@@ -98,6 +98,9 @@ StateTestInFiller::StateTestInFiller(spDataObject& _data)
                 {"verifyBC", {{DataType::Object}, jsonField::Optional}},
                 {"transaction", {{DataType::Object}, jsonField::Required}}});
 
+        // Run the compilers of all test sources at once
+        PrecompiledCode const precompiled(collectFillerCode(_data));
+
         // UnitTests
         if (_data->count("exceptions"))
         {
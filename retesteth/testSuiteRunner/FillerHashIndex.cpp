@@ -0,0 +1,197 @@
+#include "FillerHashIndex.h"
+#include <libdataobj/ConvertFile.h>
+#include <libdevcore/CommonIO.h>
+#include <retesteth/EthChecks.h>
+#include <retesteth/helpers/TestHelper.h>
+#include <boost/filesystem.hpp>
+#include <sys/stat.h>
+
+using namespace std;
+using namespace dev;
+using namespace test;
+using namespace test::debug;
+namespace fs = boost::filesystem;
+
+namespace
+{
+string const c_indexFileName = ".fillerHashIndex";
+string const c_fillers = "fillers";
+string const c_filled = "filled";
+string const c_stat = "stat";
+string const c_hash = "hash";
+string const c_tests = "tests";
+string const c_info = "_info";
+
+// Only the fields used by checkFillerHash
+spDataObject copyTestInfo(DataObject const& _test)
+{
+    if (_test.type() != DataType::Object)
+        return _test.copy();
+    spDataObject test(new DataObject(DataType::Object));
+    if (_test.count(c_info))
+    {
+        DataObject const& info = _test.atKey(c_info);
+        spDataObject infoCopy(new DataObject(DataType::Object));
+        for (auto const& field : {"sourceHash", "filling-tool-version"})
+            if (info.count(field))
+                (*infoCopy)[field] = info.atKey(field).asString();
+        (*test).addSubObject(c_info, infoCopy);
+    }
+    return test;
+}
+}  // namespace
+
+namespace test::testsuite
+{
+FillerHashIndex::FillerHashIndex(fs::path const& _filledPath) : m_indexPath(_filledPath / c_indexFileName)
+{
+    string const version = test::fto_string(retestethVersion());
+    if (fs::exists(m_indexPath))
+    {
+        try
+        {
+            m_index = ConvertJsoncppStringToData(dev::contentsString(m_indexPath));
+            if (m_index->type() == DataType::Object && m_index->count("version") &&
+                m_index->atKey("version").asString() == version && m_index->count(c_fillers) && m_index->count(c_filled))
+                return;
+        }
+        catch (std::exception const& _ex)
+        {
+            ETH_DC_MESSAGE(DC::TESTLOG, "Filler hash index is broken: " + m_indexPath.string() + " " + _ex.what());
+        }
+    }
+
+    m_index = spDataObject(new DataObject(DataType::Object));
+    (*m_index)["version"] = version;
+    (*m_index).addSubObject(c_fillers, spDataObject(new DataObject(DataType::Object)));
+    (*m_index).addSubObject(c_filled, spDataObject(new DataObject(DataType::Object)));
+    m_modified = true;
+}
+
+FillerHashIndex::~FillerHashIndex()
+{
+    try
+    {
+        save();
+    }
+    catch (std::exception const& _ex)
+    {
+        ETH_WARNING(string("Could not write filler hash index: ") + _ex.what());
+    }
+}
+
+string FillerHashIndex::fileStat(fs::path const& _file)
+{
+#if defined(__linux__) || defined(__APPLE__)
+    struct stat st;
+    if (::stat(_file.c_str(), &st) != 0)
+        return string();
+#if defined(__APPLE__)
+    struct timespec const& mtime = st.st_mtimespec;
+#else
+    struct timespec const& mtime = st.st_mtim;
+#endif
+    return to_string(st.st_size) + ":" + to_string(mtime.tv_sec) + "." + to_string(mtime.tv_nsec) + ":" +
+           to_string(st.st_ino);
+#else
+    // Only one second resolution of the modification time here
+    boost::system::error_code ec;
+    uintmax_t const size = fs::file_size(_file, ec);
+    if (ec)
+        return string();
+    std::time_t const mtime = fs::last_write_time(_file, ec);
+    if (ec)
+        return string();
+    return to_string(size) + ":" + to_string(mtime);
+#endif
+}
+
+DataObject& FillerHashIndex::entry(string const& _section, fs::path const& _file, string const& _stat)
+{
+    DataObject& section = m_index.getContent().atKeyUnsafe(_section);
+    if (!section.count(_file.string()))
+        section.addSubObject(_file.string(), spDataObject(new DataObject(DataType::Object)));
+    DataObject& entry = section.atKeyUnsafe(_file.string());
+    entry[c_stat] = _stat;
+    m_modified = true;
+    return entry;
+}
+
+TestFileData FillerHashIndex::filler(fs::path const& _filler)
+{
+    TestFileData res;
+    string const stat = fileStat(_filler);
+    std::unique_lock<std::mutex> lock(m_mutex);
+    DataObject const& fillers = m_index->atKey(c_fillers);
+    if (!stat.empty() && fillers.count(_filler.string()))
+    {
+        DataObject const& cached = fillers.atKey(_filler.string());
+        if (cached.count(c_stat) && cached.atKey(c_stat).asString() == stat && cached.count(c_hash))
+        {
+            string const& hash = cached.atKey(c_hash).asString();
+            res.hashCalculated = !hash.empty();
+            if (res.hashCalculated)
+                res.hash = h256(hash);
+            return res;
+        }
+    }
+
+    lock.unlock();
+    TestFileData const fillerData = readFillerTestFile(_filler);
+    res.hash = fillerData.hash;
+    res.hashCalculated = fillerData.hashCalculated;
+    lock.lock();
+    entry(c_fillers, _filler, stat)[c_hash] = res.hashCalculated ? res.hash.hex() : string();
+    return res;
+}
+
+spDataObject FillerHashIndex::filled(fs::path const& _filled)
+{
+    string const stat = fileStat(_filled);
+    std::unique_lock<std::mutex> lock(m_mutex);
+    DataObject& filled = m_index.getContent().atKeyUnsafe(c_filled);
+    if (!stat.empty() && filled.count(_filled.string()))
+    {
+        DataObject& cached = filled.atKeyUnsafe(_filled.string());
+        if (cached.count(c_stat) && cached.atKey(c_stat).asString() == stat && cached.count(c_tests))
+            return cached.atKeyPointerUnsafe(c_tests);
+    }
+
+    lock.unlock();
+    CJOptions opt { .stopper = "_info" };
+    spDataObject const filledTestData = test::readJsonData(_filled, opt);
+    spDataObject tests(new DataObject(DataType::Object));
+    for (auto const& test : filledTestData->getSubObjects())
+        (*tests).addSubObject(test->getKey(), copyTestInfo(test));
+
+    lock.lock();
+    DataObject& cached = entry(c_filled, _filled, stat);
+    if (cached.count(c_tests))
+        cached.removeKey(c_tests);
+    cached.addSubObject(c_tests, tests);
+    return tests;
+}
+
+void FillerHashIndex::save()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (!m_modified)
+        return;
+
+    // Drop the files that were removed
+    spDataObject index(new DataObject(DataType::Object));
+    (*index)["version"] = m_index->atKey("version").asString();
+    for (auto const& section : {c_fillers, c_filled})
+    {
+        spDataObject entries(new DataObject(DataType::Object));
+        for (auto const& el : m_index->atKey(section).getSubObjects())
+            if (fs::exists(el->getKey()))
+                (*entries).addSubObject(el->getKey(), el);
+        (*index).addSubObject(section, entries);
+    }
+    string const json = index->asJson(0, false);
+    dev::writeFile(m_indexPath, dev::bytesConstRef(json), true);
+    m_modified = false;
+}
+
+}  // namespace test::testsuite
@@ -0,0 +1,38 @@
+#pragma once
+#include "TestSuiteHelperFunctions.h"
+#include <boost/filesystem/path.hpp>
+#include <mutex>
+
+namespace test::testsuite
+{
+// On disk index of filler hashes and filled tests _info in a filled tests folder
+// Entries are reused while the file size, mtime and inode stay the same,
+// so unchanged fillers and filled tests are not parsed again on every run
+// Files are read without holding the index, so fillers could be checked by many threads
+class FillerHashIndex
+{
+public:
+    FillerHashIndex(boost::filesystem::path const& _filledPath);
+    ~FillerHashIndex();
+
+    // Filler source hash, without the filler data
+    TestFileData filler(boost::filesystem::path const& _filler);
+
+    // Tests of the filled test file with their _info sourceHash and filling-tool-version
+    // The returned object stays valid when another thread updates the entry
+    spDataObject filled(boost::filesystem::path const& _filled);
+
+    // Atomically write the index if it has changed
+    void save();
+
+    static std::string fileStat(boost::filesystem::path const& _file);
+
+private:
+    DataObject& entry(std::string const& _section, boost::filesystem::path const& _file, std::string const& _stat);
+    boost::filesystem::path m_indexPath;
+    spDataObject m_index;
+    bool m_modified = false;
+    std::mutex m_mutex;
+};
+
+}  // namespace test::testsuite
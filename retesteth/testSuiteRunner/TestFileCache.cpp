@@ -0,0 +1,139 @@
+#include "TestFileCache.h"
+#include <libdataobj/ConvertBinary.h>
+#include <libdevcore/CommonIO.h>
+#include <libdevcore/SHA3.h>
+#include <retesteth/EthChecks.h>
+#include <retesteth/Options.h>
+#include <retesteth/helpers/TestHelper.h>
+#include <boost/filesystem.hpp>
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+using namespace std;
+using namespace dev;
+using namespace dataobject;
+using namespace test::debug;
+namespace fs = boost::filesystem;
+
+namespace
+{
+#if !defined(_WIN32)
+// Read only mapping of a whole file
+class MappedFile
+{
+public:
+    MappedFile(fs::path const& _file)
+    {
+        int const fd = open(_file.c_str(), O_RDONLY);
+        if (fd < 0)
+            return;
+        struct stat st;
+        if (fstat(fd, &st) == 0 && st.st_size > 0)
+        {
+            void* data = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (data != MAP_FAILED)
+            {
+                m_data = static_cast<char const*>(data);
+                m_size = st.st_size;
+            }
+        }
+        close(fd);
+    }
+    ~MappedFile()
+    {
+        if (m_data != nullptr)
+            munmap(const_cast<char*>(m_data), m_size);
+    }
+    MappedFile(MappedFile const&) = delete;
+    MappedFile& operator=(MappedFile const&) = delete;
+    char const* data() const { return m_data; }
+    size_t size() const { return m_size; }
+
+private:
+    char const* m_data = nullptr;
+    size_t m_size = 0;
+};
+#endif
+}  // namespace
+
+namespace test::testsuite
+{
+TestFileCache::TestFileCache(fs::path const& _dir, size_t _maxBytes) : m_folder(_dir, _maxBytes, "Test file cache") {}
+
+TestFileCache& TestFileCache::get()
+{
+    Options const& opt = Options::get();
+    static TestFileCache cache(fs::path(opt.testCache), opt.testCacheSize * 1024 * 1024);
+    return cache;
+}
+
+string TestFileCache::key(string const& _content, CJOptions const& _opt)
+{
+    string const options = string(_opt.jsonParse == CJOptions::JsonParse::ALLOW_COMMENTS ? "c" : "s") + (_opt.autosort ? "a" : "n");
+    return dev::sha3(options + '\0' + _content).hex();
+}
+
+spDataObject TestFileCache::readJson(fs::path const& _file, CJOptions const& _opt)
+{
+    // Key replace and stopper change the parsed data, such reads are not cached
+    if (!m_folder.enabled() || !_opt.stopper.empty() || _opt.keyReplace != nullptr)
+        return test::readJsonData(_file, _opt);
+
+    string const entryKey = key(dev::contentsString(_file), _opt);
+    spDataObject data = find(entryKey);
+    if (!data.isEmpty())
+    {
+        ETH_DC_MESSAGE(DC::LOWLOG, "Test file cache hit: " + _file.filename().string());
+        return data;
+    }
+
+    data = test::readJsonData(_file, _opt);
+    if (!data.isEmpty())
+        insert(entryKey, data.getCContent());
+    return data;
+}
+
+spDataObject TestFileCache::find(string const& _key) const
+{
+    fs::path const path = m_folder.entryPath(_key);
+    boost::system::error_code ec;
+    if (!fs::exists(path, ec))
+        return spDataObject(0);
+    try
+    {
+#if defined(_WIN32)
+        string const content = dev::contentsString(path);
+        spDataObject data = ConvertBinaryToData(content.data(), content.size());
+#else
+        MappedFile const file(path);
+        if (file.data() == nullptr)
+            return spDataObject(0);
+        spDataObject data = ConvertBinaryToData(file.data(), file.size());
+#endif
+        m_folder.markUsed(_key);
+        return data;
+    }
+    catch (std::exception const& _ex)
+    {
+        ETH_WARNING(string("Ignoring broken test file cache entry ") + path.string() + ": " + _ex.what());
+        return spDataObject(0);
+    }
+}
+
+void TestFileCache::insert(string const& _key, DataObject const& _data)
+{
+    try
+    {
+        m_folder.write(_key, ConvertDataToBinary(_data));
+    }
+    catch (std::exception const& _ex)
+    {
+        ETH_WARNING(string("Could not write test file cache entry: ") + _ex.what());
+    }
+}
+
+}  // namespace test::testsuite
@@ -0,0 +1,32 @@
+#pragma once
+#include <libdataobj/ConvertFile.h>
+#include <retesteth/helpers/CacheFolder.h>
+#include <boost/filesystem/path.hpp>
+
+namespace test::testsuite
+{
+// On disk cache of parsed json test files in binary DataObject form
+// Entries are keyed by hash(file content + parse options) and written with atomic rename,
+// so unchanged tests are mapped from the cache instead of being parsed on every run
+// Folder size is bound by removing the least recently used entries
+class TestFileCache
+{
+public:
+    // Empty _dir disables the cache
+    TestFileCache(boost::filesystem::path const& _dir, size_t _maxBytes);
+    static TestFileCache& get();
+
+    // Same as readJsonData, takes the parsed data from the cache when the file is unchanged
+    dataobject::spDataObject readJson(
+        boost::filesystem::path const& _file, dataobject::CJOptions const& _opt = dataobject::CJOptions());
+
+    static std::string key(std::string const& _content, dataobject::CJOptions const& _opt);
+    dataobject::spDataObject find(std::string const& _key) const;
+    void insert(std::string const& _key, dataobject::DataObject const& _data);
+    void evict() { m_folder.evict(); }
+
+private:
+    CacheFolder m_folder;
+};
+
+}  // namespace test::testsuite
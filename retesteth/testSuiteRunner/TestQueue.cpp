@@ -0,0 +1,139 @@
+#include "TestQueue.h"
+#include <retesteth/EthChecks.h>
+#include <retesteth/ExitHandler.h>
+#include <retesteth/Options.h>
+#include <retesteth/helpers/TestHelper.h>
+#include <retesteth/helpers/TestHistory.h>
+#include <retesteth/helpers/TestOutputHelper.h>
+#include <retesteth/session/Session.h>
+#include <retesteth/session/ThreadManager.h>
+#include <retesteth/testSuites/TestFixtures.h>
+#include <atomic>
+#include <memory>
+#include <mutex>
+
+using namespace std;
+using namespace test;
+using namespace test::debug;
+using namespace test::session;
+using namespace test::testsuite;
+
+namespace
+{
+struct QueuedFolder
+{
+    string name;
+    TestInfo::CaseNames testCase;
+    std::function<void()> onFinished;
+    std::atomic<size_t> remaining = 0;
+    std::once_flag started;
+    bool queued = false;  // a task was given to a thread, changed by the queue thread only
+    std::unique_ptr<TestOutputTimer> timer;
+};
+
+struct QueuedTask
+{
+    TestQueue::Task task;
+    shared_ptr<QueuedFolder> folder;
+};
+
+// Filled by the boost thread, then run when all test cases have been listed
+vector<QueuedTask> g_queue;
+
+void finishFolder(QueuedFolder& _folder)
+{
+    if (Options::get().exectimelog)
+        _folder.timer->printFinishTest(_folder.name);
+    if (_folder.onFinished)
+        _folder.onFinished();
+    ETH_DC_MESSAGE(DC::STATS, "Test Case \"" + _folder.name + "\" finished");
+}
+}  // namespace
+
+namespace test::testsuite
+{
+bool TestQueue::enabled()
+{
+    static bool const enabled = []() {
+        if (!Options::get().globalQueue)
+            return false;
+        if (Options::getDynamicOptions().getClientConfigs().size() > 1)
+        {
+            ETH_WARNING("--globalqueue runs tests for one client config only, running folder by folder!");
+            return false;
+        }
+        return true;
+    }();
+    return enabled;
+}
+
+void TestQueue::addFolder(string const& _folder, vector<Task>&& _tasks, std::function<void()> const& _onFinished)
+{
+    if (_tasks.empty())
+    {
+        if (_onFinished)
+            _onFinished();
+        return;
+    }
+
+    auto folder = make_shared<QueuedFolder>();
+    folder->name = _folder;
+    folder->testCase = TestInfo::currentCase();
+    folder->onFinished = _onFinished;
+    folder->remaining = _tasks.size();
+    for (auto& task : _tasks)
+        g_queue.push_back({std::move(task), folder});
+    ETH_DC_MESSAGE(DC::STATS, "Queued " + test::fto_string(_tasks.size()) + " tests of " + _folder);
+}
+
+size_t TestQueue::run()
+{
+    if (g_queue.empty())
+        return 0;
+    vector<QueuedTask> queue = std::move(g_queue);
+    g_queue.clear();
+
+    vector<string> keys;
+    vector<bool> slowTests;
+    for (auto const& el : queue)
+    {
+        keys.emplace_back(el.task.key);
+        slowTests.emplace_back(el.task.slow);
+    }
+
+    ETH_DC_MESSAGE(DC::STATS, "Running " + test::fto_string(queue.size()) + " tests from the global queue");
+    auto& testOutput = TestOutputHelper::get();
+    testOutput.initQueue(queue.size());
+    for (size_t const i : TestHistory::get().order(keys, slowTests))
+    {
+        if (ExitHandler::receivedExitSignal())
+            break;
+        QueuedTask const& queued = queue.at(i);
+
+        // Ipc instances are recycled one by one when a worker takes an over-used one
+        // Other clients are restarted like a folder run does, the running tests must finish with them first
+        bool const timeConsuming = !queued.folder->queued && TestChecker::isTimeConsumingTest(queued.folder->name);
+        queued.folder->queued = true;
+        if (!RPCSession::recyclesOnReuse() && (timeConsuming || RPCSession::isRunningTooLong()))
+        {
+            ThreadManager::joinThreads();
+            RPCSession::restartScripts(true);
+        }
+
+        testOutput.showProgress();
+        if (ExitHandler::receivedExitSignal())
+            break;
+        auto job = [job = queued.task.job, folder = queued.folder]() {
+            std::call_once(folder->started, [&folder]() { folder->timer = std::make_unique<TestOutputTimer>(); });
+            TestOutputHelper::get().setQueuedTestCase(folder->testCase);
+            job();
+            if (--folder->remaining == 0)
+                finishFolder(*folder);
+        };
+        ThreadManager::addTask(job);
+    }
+    ThreadManager::joinThreads();
+    return testOutput.finishTest(false);
+}
+
+}  // namespace test::testsuite
@@ -0,0 +1,31 @@
+#pragma once
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace test::testsuite
+{
+// One queue of the test fillers of all selected folders for --globalqueue
+// Boost test cases only add their folders, the queue runs after the last test case without a thread
+// join at every folder end. Folder bookkeeping is done by a callback after the last filler of the folder
+class TestQueue
+{
+public:
+    struct Task
+    {
+        std::string key;    // test name in the time history
+        bool slow = false;  // known as time consuming
+        std::function<void()> job;
+    };
+
+    // --globalqueue is set and the tests run for one client config
+    static bool enabled();
+
+    // Queue _tasks of the current boost test case, _onFinished is called when all of them are done
+    static void addFolder(std::string const& _folder, std::vector<Task>&& _tasks, std::function<void()> const& _onFinished);
+
+    // Run the queued tasks longest first, returns the number of errors
+    static size_t run();
+};
+
+}  // namespace test::testsuite
@@ -0,0 +1,130 @@
+#include "TestShard.h"
+#include <libdevcore/SHA3.h>
+#include <retesteth/EthChecks.h>
+#include <retesteth/Options.h>
+#include <retesteth/helpers/TestHistory.h>
+#include <retesteth/helpers/TestReport.h>
+#include <algorithm>
+#include <numeric>
+
+using namespace std;
+
+namespace
+{
+// Same value on every machine, unlike std::hash
+uint64_t stableHash(string const& _str)
+{
+    dev::h256 const hash = dev::sha3(_str);
+    uint64_t res = 0;
+    for (size_t i = 0; i < 8; i++)
+        res = (res << 8) | hash[i];
+    return res;
+}
+}  // namespace
+
+namespace test::testsuite
+{
+TestShard::TestShard()
+{
+    auto const& opt = Options::get();
+    if (!opt.shard.initialized())
+        return;
+    m_index = opt.shard.index;
+    m_count = opt.shard.count;
+    if (opt.shardWeights.initialized())
+    {
+        // A test report of a previous run or a --testhistory file
+        try
+        {
+            for (auto const& el : TestReport::read(opt.shardWeights).tests)
+                m_durations.emplace(el.first, el.second.time);
+        }
+        catch (std::exception const& _reportEx)
+        {
+            try
+            {
+                m_durations = TestHistory::readTimes(opt.shardWeights);
+            }
+            catch (std::exception const& _historyEx)
+            {
+                ETH_FAIL_MESSAGE(string("Could not read --shardweights as a test report: ") + _reportEx.what() +
+                                 "\nnor as a test history: " + _historyEx.what());
+            }
+        }
+    }
+}
+
+TestShard const& TestShard::get()
+{
+    static TestShard shard;
+    return shard;
+}
+
+vector<size_t> TestShard::select(string const& _group, vector<string> const& _keys) const
+{
+    return select(_group, _keys, m_durations, m_index, m_count);
+}
+
+vector<size_t> TestShard::select(string const& _group, vector<string> const& _keys,
+    map<string, double> const& _durations, size_t _index, size_t _count)
+{
+    vector<size_t> selected;
+    double knownTime = 0;
+    size_t knownCount = 0;
+    for (auto const& key : _keys)
+    {
+        auto const it = _durations.find(key);
+        if (it != _durations.end())
+        {
+            knownTime += it->second;
+            knownCount++;
+        }
+    }
+
+    if (knownCount == 0)
+    {
+        for (size_t i = 0; i < _keys.size(); i++)
+            if (stableHash(_keys.at(i)) % _count + 1 == _index)
+                selected.emplace_back(i);
+        return selected;
+    }
+
+    // New tests are expected to take an average time
+    double const averageTime = knownTime / knownCount;
+    vector<double> durations;
+    for (auto const& key : _keys)
+    {
+        auto const it = _durations.find(key);
+        durations.emplace_back(it != _durations.end() ? it->second : averageTime);
+    }
+
+    vector<size_t> order(_keys.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [&durations, &_keys](size_t _a, size_t _b) {
+        if (durations.at(_a) != durations.at(_b))
+            return durations.at(_a) > durations.at(_b);
+        return _keys.at(_a) < _keys.at(_b);
+    });
+
+    // Equal loads are broken from a folder dependent shard, so the longest tests of all folders
+    // do not end up on the first shard
+    size_t const offset = stableHash(_group) % _count;
+    vector<double> loads(_count, 0);
+    for (size_t const i : order)
+    {
+        size_t best = offset;
+        for (size_t k = 1; k < _count; k++)
+        {
+            size_t const shard = (offset + k) % _count;
+            if (loads.at(shard) < loads.at(best))
+                best = shard;
+        }
+        loads.at(best) += durations.at(i);
+        if (best + 1 == _index)
+            selected.emplace_back(i);
+    }
+    std::sort(selected.begin(), selected.end());
+    return selected;
+}
+
+}  // namespace test::testsuite
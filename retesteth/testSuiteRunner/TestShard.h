@@ -0,0 +1,32 @@
+#pragma once
+#include <map>
+#include <string>
+#include <vector>
+
+namespace test::testsuite
+{
+// Deterministic split of the test fillers between the `--shard i/N` machines
+// Without durations a test goes to the shard of its name hash. With durations of a previous run
+// tests are assigned longest first to the least loaded shard, every machine computes the same split
+class TestShard
+{
+public:
+    static TestShard const& get();
+
+    bool enabled() const { return m_count > 1; }
+
+    // Positions of _keys that belong to this shard, _group is the folder of the keys
+    std::vector<size_t> select(std::string const& _group, std::vector<std::string> const& _keys) const;
+
+    // Positions of _keys that belong to shard _index (from 1) of _count
+    static std::vector<size_t> select(std::string const& _group, std::vector<std::string> const& _keys,
+        std::map<std::string, double> const& _durations, size_t _index, size_t _count);
+
+private:
+    TestShard();
+    size_t m_index = 1;
+    size_t m_count = 1;
+    std::map<std::string, double> m_durations;  // test => seconds from --shardweights report or history
+};
+
+}  // namespace test::testsuite
@@ -18,13 +18,19 @@
  * Base functions for all test suites
  */
 
+#include "TestFileCache.h"
+#include "TestQueue.h"
+#include "TestShard.h"
 #include "TestSuiteHelperFunctions.h"
 #include <libdevcore/CommonIO.h>
 #include <retesteth/EthChecks.h>
 #include <retesteth/ExitHandler.h>
 #include <retesteth/Options.h>
+#include <retesteth/helpers/CompressedFile.h>
 #include <retesteth/helpers/TestHelper.h>
+#include <retesteth/helpers/TestHistory.h>
 #include <retesteth/helpers/TestOutputHelper.h>
+#include <retesteth/helpers/TraceSpan.h>
 #include <retesteth/session/Session.h>
 #include <retesteth/session/ThreadManager.h>
 #include <retesteth/testSuiteRunner/TestSuite.h>
@@ -42,7 +48,7 @@ namespace
 {
 string getTestNameFromFillerFilename(fs::path const& _fillerTestFilePath)
 {
-    string const fillerName = _fillerTestFilePath.stem().string();
+    string const fillerName = testFileStem(_fillerTestFilePath);
     size_t pos = fillerName.rfind(c_fillerPostf);
     if (pos != string::npos)
         return fillerName.substr(0, pos);
@@ -59,28 +65,45 @@ string getTestNameFromFillerFilename(fs::path const& _fillerTestFilePath)
         false, "Incorrect file suffix in the filler folder! " + _fillerTestFilePath.string() + requireStr);
     return fillerName;
 }
+
+bool isSlowTest(string const& _testFolder, fs::path const& _fillerTestFilePath)
+{
+    return TestChecker::isTimeConsumingTest(_testFolder) || TestChecker::isCPUIntenseTest(testFileStem(_fillerTestFilePath));
+}
 }  // namespace
 
 namespace test
 {
 
-void TestSuite::runAllTestsInFolder(string const& _testFolder) const
+void TestSuite::runAllTestsInFolder(string const& _testFolder, std::function<void()> const& _onFinished,
+    std::shared_ptr<TestSuite const> const& _suite) const
 {
+    auto const folderFinished = [&_onFinished]() {
+        if (_onFinished)
+            _onFinished();
+    };
     Options::getDynamicOptions().getClientConfigs();
-    CHECKEXIT
+    if (ExitHandler::receivedExitSignal())
+    {
+        folderFinished();
+        return;
+    }
 
     clearGeneratedTestNamesMap();
     std::vector<fs::path> outdatedTestFillers;
     std::vector<fs::path> allTestFillers;
     if (!verifyFillers(_testFolder, outdatedTestFillers, allTestFillers))
+    {
+        folderFinished();
         return;
+    }
 
     // run all tests
     AbsoluteFillerPath fillerPath = getFullPathFiller(_testFolder);
     if (!fs::exists(fillerPath.path()))
         ETH_WARNING(string(fillerPath.path().c_str()) + " does not exist!");
 
-    vector<fs::path> const& testFillers = Options::get().filloutdated ?
+    vector<fs::path> testFillers = Options::get().filloutdated ?
                                           outdatedTestFillers : allTestFillers;
 
     if (testFillers.size() == 0)
@@ -88,6 +111,60 @@ void TestSuite::runAllTestsInFolder(string const& _testFolder) const
         TestOutputHelper::get().currentTestRunPP();
         ETH_WARNING(_testFolder + " no tests detected in folder!");
     }
+    else if (TestShard::get().enabled())
+    {
+        vector<string> testKeys;
+        for (auto const& filler : testFillers)
+            testKeys.emplace_back(testResultKey(_testFolder, filler));
+        vector<fs::path> shardFillers;
+        for (size_t const i : TestShard::get().select((suiteFolder().path() / _testFolder).string(), testKeys))
+            shardFillers.emplace_back(testFillers.at(i));
+        ETH_DC_MESSAGE(DC::STATS, "Shard " + Options::get().shard.str() + ": " + test::fto_string(shardFillers.size()) +
+                                      " of " + test::fto_string(testFillers.size()) + " tests in " + _testFolder);
+        testFillers = std::move(shardFillers);
+    }
+
+    if (_suite != nullptr && TestQueue::enabled())
+    {
+        // Only list the folder tests, TestQueue runs them after the last test case
+        auto queueFolder = [&_suite, &testFillers, &_testFolder, &_onFinished]() {
+            _suite->prepareTests(_testFolder, testFillers);
+            test::TestOutputHelper::get().initTest(testFillers.size());
+            vector<TestQueue::Task> tasks;
+            for (auto const& testFillerPath : testFillers)
+            {
+                if (Options::get().lowcpu && TestChecker::isCPUIntenseTest(testFileStem(testFillerPath)))
+                {
+                    ETH_WARNING("Skipping " + testFileStem(testFillerPath) + " because --lowcpu option was specified.\n");
+                    continue;
+                }
+                TestQueue::Task task;
+                task.key = _suite->testResultKey(_testFolder, testFillerPath);
+                task.slow = isSlowTest(_testFolder, testFillerPath);
+                task.job = [_suite, _testFolder, testFillerPath]() { _suite->executeTest(_testFolder, testFillerPath); };
+                tasks.emplace_back(std::move(task));
+            }
+            TestQueue::addFolder(_testFolder, std::move(tasks), _onFinished);
+        };
+        runFunctionForAllClients(queueFolder);
+        return;
+    }
+
+    // Longest tests first, so the threads finish the folder at about the same time
+    if (Options::get().threadCount > 1 && testFillers.size() > 1)
+    {
+        vector<string> testKeys;
+        vector<bool> slowTests;
+        for (auto const& filler : testFillers)
+        {
+            testKeys.emplace_back(testResultKey(_testFolder, filler));
+            slowTests.emplace_back(isSlowTest(_testFolder, filler));
+        }
+        vector<fs::path> orderedFillers;
+        for (size_t const i : TestHistory::get().order(testKeys, slowTests))
+            orderedFillers.emplace_back(testFillers.at(i));
+        testFillers = std::move(orderedFillers);
+    }
 
 
     // repeat this part for all connected clients
@@ -97,14 +174,15 @@ void TestSuite::runAllTestsInFolder(string const& _testFolder) const
         if (RPCSession::isRunningTooLong() || TestChecker::isTimeConsumingTest(_testFolder.c_str()))
             RPCSession::restartScripts(true);
 
+        prepareTests(_testFolder, testFillers);
         testOutput.initTest(testFillers.size());
         for (auto const& testFillerPath : testFillers)
         {
             if (ExitHandler::receivedExitSignal())
                 break;
-            if (Options::get().lowcpu && TestChecker::isCPUIntenseTest(testFillerPath.stem().string()))
+            if (Options::get().lowcpu && TestChecker::isCPUIntenseTest(testFileStem(testFillerPath)))
             {
-                ETH_WARNING("Skipping " + testFillerPath.stem().string() + " because --lowcpu option was specified.\n");
+                ETH_WARNING("Skipping " + testFileStem(testFillerPath) + " because --lowcpu option was specified.\n");
                 continue;
             }
 
@@ -119,6 +197,7 @@ void TestSuite::runAllTestsInFolder(string const& _testFolder) const
         testOutput.finishTest();
     };
     runFunctionForAllClients(thisPart);
+    folderFinished();
 }
 
 
@@ -139,16 +218,26 @@ void TestSuite::runFunctionForAllClients(std::function<void()> _func)
     }
 }
 
+string TestSuite::testResultKey(string const& _testFolder, fs::path const& _fillerTestFilePath) const
+{
+    return (suiteFolder().path() / _testFolder / getTestNameFromFillerFilename(_fillerTestFilePath)).string();
+}
+
 void TestSuite::executeTest(string const& _testFolder, fs::path const& _fillerTestFilePath) const
 {
+    dev::Timer timer;
+    size_t const errorsBefore = TestOutputHelper::get().getErrors().size();
     try
     {
+        ETH_TRACE_SPAN("executeTest");
         _executeTest(_testFolder, _fillerTestFilePath);
     }
     catch (std::exception const& _ex)
     {
         RPCSession::sessionEnd(TestOutputHelper::getThreadID(), RPCSession::SessionStatus::HasFinished);
     }
+    bool const failed = TestOutputHelper::get().getErrors().size() > errorsBefore;
+    TestOutputHelper::registerTestResult(testResultKey(_testFolder, _fillerTestFilePath), timer.elapsed(), failed);
 }
 
 void TestSuite::_executeTest(string const& _testFolder, fs::path const& _fillerTestFilePath) const
@@ -192,12 +281,12 @@ void TestSuite::_executeTest(string const& _testFolder, fs::path const& _fillerT
             && !opt.filltests)
         {
             // Select single test from python generated tests
-            _runTest(filledTestPath.path().parent_path() / (opt.singletest.name + ".json"));
+            _runTest(findTestFile(filledTestPath.path().parent_path() / (opt.singletest.name + ".json")));
         }
         else
         {
             for (auto const& name : generatedFiles)
-                _runTest(filledTestPath.path().parent_path() / (name + ".json"));
+                _runTest(findTestFile(filledTestPath.path().parent_path() / (name + ".json")));
         }
     }
 
@@ -236,13 +325,13 @@ void TestSuite::executeFile(boost::filesystem::path const& _file) const
     static bool isLegacy = Options::get().rCurrentTestSuite.find("LegacyTests") != string::npos;
     opt.isLegacyTests = isLegacy || legacyTestSuiteFlag();
 
-    if (_file.extension() != ".json")
-        ETH_ERROR_MESSAGE("The generated test must have `.json` format! (forgot --filltests?)");
+    if (withoutCompression(_file).extension() != ".json")
+        ETH_ERROR_MESSAGE("The generated test must have `.json`, `.json.gz` or `.json.zst` format! (forgot --filltests?)");
 
     ETH_DC_MESSAGE(DC::TESTLOG, "Read json structure " + _file.filename().string());
     TestOutputHelper::get().setCurrentTestInfo(
         TestInfo("Read json structure: "  + _file.filename().string()));
-    spDataObject res = test::readJsonData(_file);
+    spDataObject res = TestFileCache::get().readJson(_file);
     ETH_DC_MESSAGE(DC::TESTLOG, "Read json finish");
     doTests(res, opt);
 }
@@ -23,6 +23,7 @@
 #include <retesteth/testSuiteRunner/TestSuiteHelperFunctions.h>
 #include <boost/filesystem/path.hpp>
 #include <functional>
+#include <memory>
 
 namespace test
 {
@@ -99,7 +100,14 @@ public:
     // If src test file is named Copier it will just copy it from /src folder because such test is crafted and
     // it's RLP could not be generated by the client
     // If the src test does not end up with either Filler.json or Copier.json an exception occurs.
-    void runAllTestsInFolder(std::string const& _testFolder) const;
+    // _onFinished is called when the folder tests are done. With --globalqueue the folder of a shared _suite
+    // (this suite) is only queued, and its tests run after the last boost test case
+    void runAllTestsInFolder(std::string const& _testFolder, std::function<void()> const& _onFinished = {},
+        std::shared_ptr<TestSuite const> const& _suite = nullptr) const;
+
+    // Called for every client before the tests of _testFolder are run, a suite can prepare the data
+    // of all _testFillers at once here
+    virtual void prepareTests(std::string const&, std::vector<boost::filesystem::path> const&) const {}
 
     // Execute Filler.json or Copier.json test file in a given folder
     void executeTest(std::string const& _testFolder, boost::filesystem::path const& _jsonFileName) const;
@@ -129,6 +137,8 @@ protected:
 
 private:
     void _executeTest(std::string const& _testFolder, boost::filesystem::path const& _jsonFileName) const;
+    // suiteFolder()/_testFolder/testName, identifies the filler in test reports and shards
+    std::string testResultKey(std::string const& _testFolder, boost::filesystem::path const& _fillerTestFilePath) const;
     bool _fillTest(TestSuite::TestSuiteOptions& _opt, boost::filesystem::path const& _fillerTestFilePath,
         AbsoluteFilledTestPath const& _outputTestFilePath) const;
     void _runTest(AbsoluteFilledTestPath const& _filledTestPath) const;
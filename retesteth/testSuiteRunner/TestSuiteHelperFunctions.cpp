@@ -1,6 +1,8 @@
 #include "TestSuiteHelperFunctions.h"
+#include "TestFileCache.h"
 #include "Options.h"
 #include <retesteth/EthChecks.h>
+#include <retesteth/helpers/CompressedFile.h>
 #include <retesteth/helpers/TestHelper.h>
 #include <retesteth/helpers/TestOutputHelper.h>
 #include <retesteth/testSuiteRunner/TestSuite.h>
@@ -26,12 +28,13 @@ TestFileData readFillerTestFile(fs::path const& _testFileName)
     // Adds around 1% to execution time
     ETH_DC_MESSAGE(DC::TESTLOG, "Read json structure " + string(_testFileName.filename().c_str()));
     TestFileData testData;
-    if (_testFileName.extension() == ".json")
+    auto const extension = withoutCompression(_testFileName).extension();
+    if (extension == ".json")
     {
         CJOptions opt { .jsonParse = CJOptions::JsonParse::ALLOW_COMMENTS, .autosort = bSortOnLoad,};
-        testData.data = test::readJsonData(_testFileName, opt);
+        testData.data = TestFileCache::get().readJson(_testFileName, opt);
     }
-    else if (_testFileName.extension() == ".yml")
+    else if (extension == ".yml")
         testData.data = test::readYamlData(_testFileName, bSortOnLoad);
     else if (_testFileName.extension() == ".py")
         testData.data = spDataObject(new DataObject(dev::contentsString(_testFileName)));
@@ -57,7 +60,7 @@ TestFileData readFillerTestFile(fs::path const& _testFileName)
     {
         std::string output = "Not a Json object!";
 #ifdef JSONCPP
-        if (_testFileName.extension() == ".json")
+        if (extension == ".json")
         {
             Json::FastWriter fastWriter;
             Json::Value v = readJson(_testFileName);
@@ -142,14 +145,22 @@ void checkDoubleGeneratedTestNames()
 
 vector<string> const& getGeneratedTestNames(fs::path const& _filler)
 {
-    std::lock_guard<std::mutex> lock(G_GeneratedTestsMap_Mutex);
-    if (C_GeneratedTestsMAP.count(_filler.stem().string()))
-        return C_GeneratedTestsMAP.at(_filler.stem().string());
+    // Fillers of different folders could have the same name when --globalqueue runs them together
+    string const fillerStem = testFileStem(_filler);
+    string const fillerKey = _filler.string();
+    {
+        std::lock_guard<std::mutex> lock(G_GeneratedTestsMap_Mutex);
+        auto const it = C_GeneratedTestsMAP.find(fillerKey);
+        if (it != C_GeneratedTestsMAP.end())
+            return it->second;
+    }
 
+    // Read the filler without holding the map, fillers are checked by many threads
     vector<string> generatedTestNames;
-    if (_filler.extension() == ".json" || _filler.extension() == ".yml")
+    auto const extension = withoutCompression(_filler).extension();
+    if (extension == ".json" || extension == ".yml")
     {
-        string fillerName = _filler.stem().string();
+        string fillerName = fillerStem;
         if (fillerName.find(c_fillerPostf) != string::npos)
             fillerName = fillerName.substr(0, fillerName.length() - c_fillerPostf.size());
         else if (fillerName.find(c_copierPostf) != string::npos)
@@ -179,9 +190,8 @@ vector<string> const& getGeneratedTestNames(fs::path const& _filler)
         ETH_ERROR_MESSAGE("getGeneratedTestNames:: unknown filler extension: \n" + _filler.string());
     }
 
-    C_GeneratedTestsMAP.emplace(_filler.stem().string(), generatedTestNames);
-    return C_GeneratedTestsMAP.at(_filler.stem().string());
+    std::lock_guard<std::mutex> lock(G_GeneratedTestsMap_Mutex);
+    return C_GeneratedTestsMAP.emplace(fillerKey, std::move(generatedTestNames)).first->second;
 }
 
-
 }  // namespace testsuite
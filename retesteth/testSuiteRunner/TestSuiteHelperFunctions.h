@@ -19,7 +19,8 @@ bool addClientInfoIfUpdate(DataObject& _filledTest, boost::filesystem::path cons
 
 TestFileData readFillerTestFile(boost::filesystem::path const& _testFileName);
 void removeComments(spDataObject& _obj);
-bool checkFillerHash(boost::filesystem::path const& _compiledTest, boost::filesystem::path const& _sourceTest);
+class FillerHashIndex;
+bool checkFillerHash(boost::filesystem::path const& _compiledTest, boost::filesystem::path const& _sourceTest, FillerHashIndex& _index);
 
 void clearGeneratedTestNamesMap();
 void checkDoubleGeneratedTestNames();
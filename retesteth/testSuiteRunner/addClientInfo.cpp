@@ -1,6 +1,7 @@
 #include "TestSuiteHelperFunctions.h"
 #include <libdevcore/CommonIO.h>
 #include <retesteth/Options.h>
+#include <retesteth/helpers/CompressedFile.h>
 #include <retesteth/helpers/TestHelper.h>
 #include <retesteth/helpers/TestOutputHelper.h>
 #include <retesteth/session/Session.h>
@@ -58,8 +59,15 @@ bool addClientInfoIfUpdate(DataObject& _newFilledTestData, fs::path const& _test
     bool atLeastOneUpdate = false || Options::get().forceupdate;
 
     spDataObject oldFilledTestFile;
-    if (Options::get().filltests && fs::exists(_existingFilledTest) && !Options::get().forceupdate)
-        oldFilledTestFile = test::readJsonData(_existingFilledTest);
+    fs::path const existingFilledTest = findTestFile(_existingFilledTest);
+    if (Options::get().filltests && fs::exists(existingFilledTest) && !Options::get().forceupdate)
+    {
+        oldFilledTestFile = test::readJsonData(existingFilledTest);
+
+        // Rewrite the unchanged test when --fillcompressed selects another format
+        if (fileCompression(existingFilledTest) != fillCompression())
+            atLeastOneUpdate = true;
+    }
 
     session::SessionInterface& session = session::RPCSession::instance(TestOutputHelper::getThreadID());
     for (spDataObject& newFilledTest : _newFilledTestData.getSubObjectsUnsafe())
@@ -1,9 +1,12 @@
 #include "EthChecks.h"
 #include "Options.h"
+#include <retesteth/helpers/CompressedFile.h>
 #include <retesteth/helpers/TestHelper.h>
+#include "FillerHashIndex.h"
 #include "TestSuite.h"
 #include "TestSuiteHelperFunctions.h"
 #include <retesteth/helpers/TestOutputHelper.h>
+#include <retesteth/session/ThreadManager.h>
 
 #include <libdevcore/CommonIO.h>
 
@@ -12,6 +15,7 @@ using namespace std;
 using namespace test;
 using namespace test::debug;
 using namespace test::testsuite;
+using namespace test::session;
 namespace fs = boost::filesystem;
 
 namespace
@@ -49,44 +53,57 @@ void checkGeneratedTest(fs::path const& _filledPath, std::vector<fs::path> const
     std::vector<fs::path>& _outdatedTestFillers,
     std::vector<fs::path>& _verifiedGeneratedTests)
 {
-    auto const& opt = Options::get();
-    string message = "Tests are not generated (forgot --filltests?): ";
-    for (auto const& filler : _fillers)
+    struct FillerCheck
     {
-        TestInfo errorInfo("CheckFiller", filler.stem().string());
+        bool outdated = false;
+        string message;
+        std::vector<fs::path> verifiedGeneratedTests;
+    };
+
+    // Fillers are checked in parallel, the results are merged in the filler order
+    auto const& opt = Options::get();
+    std::vector<FillerCheck> checks(_fillers.size());
+    FillerHashIndex hashIndex(_filledPath);
+    ThreadManager::runParallel(_fillers.size(), [&](size_t _i) {
+        fs::path const& filler = _fillers.at(_i);
+        FillerCheck& check = checks.at(_i);
+        TestInfo errorInfo("CheckFiller", testFileStem(filler));
         TestOutputHelper::get().setCurrentTestInfo(errorInfo);
 
-        bool outdatedFillerRegistered = false;
-        vector<string> generatedTestNames = getGeneratedTestNames(filler);
+        vector<string> const& generatedTestNames = getGeneratedTestNames(filler);
         for (auto const& testName : generatedTestNames)
         {
-            fs::path generatedTestPath = _filledPath / (testName + ".json");
+            fs::path generatedTestPath = findTestFile(_filledPath / (testName + ".json"));
             if (fs::exists(generatedTestPath))
             {
                 // if --filltests is set, mark all tests as outdated
-                if ((opt.filltests && !opt.filloutdated) || checkFillerHash(generatedTestPath, filler))
+                if ((opt.filltests && !opt.filloutdated) || checkFillerHash(generatedTestPath, filler, hashIndex))
                 {
                     if (!opt.filloutdated)
-                        message += "\n " + filler.string() + " => " + generatedTestPath.string();
-                    if (!outdatedFillerRegistered)
-                    {
-                        _outdatedTestFillers.emplace_back(filler);
-                        outdatedFillerRegistered = true;
-                    }
+                        check.message += "\n " + filler.string() + " => " + generatedTestPath.string();
+                    check.outdated = true;
                 }
-                _verifiedGeneratedTests.emplace_back(generatedTestPath);
+                check.verifiedGeneratedTests.emplace_back(generatedTestPath);
             }
             else
             {
                 if (!opt.filloutdated)
-                    message += "\n " + filler.string() + " => " + generatedTestPath.string();
-                if (!outdatedFillerRegistered)
-                {
-                    _outdatedTestFillers.emplace_back(filler);
-                    outdatedFillerRegistered = true;
-                }
+                    check.message += "\n " + filler.string() + " => " + generatedTestPath.string();
+                check.outdated = true;
             }
         }
+    });
+    hashIndex.save();
+
+    string message = "Tests are not generated (forgot --filltests?): ";
+    for (size_t i = 0; i < _fillers.size(); i++)
+    {
+        FillerCheck const& check = checks.at(i);
+        message += check.message;
+        if (check.outdated)
+            _outdatedTestFillers.emplace_back(_fillers.at(i));
+        for (auto const& test : check.verifiedGeneratedTests)
+            _verifiedGeneratedTests.emplace_back(test);
     }
 
     if (!opt.filloutdated && _outdatedTestFillers.size() > 0 && !opt.filltests)
@@ -105,9 +122,9 @@ void checkFillersNotWithTheSameName(std::vector<fs::path> const& _allTestFillers
     std::vector<fs::path> fillersWithSameName;
     for (auto const& test : _allTestFillers)
     {
-        if (fillerNames.count(test.stem().string()))
+        if (fillerNames.count(testFileStem(test)))
             fillersWithSameName.emplace_back(test);
-        fillerNames.emplace(test.stem().string());
+        fillerNames.emplace(testFileStem(test));
     }
 
     if (fillersWithSameName.size() > 0)
@@ -125,7 +142,7 @@ void checkThatNoTestsWithoutFiller(std::vector<fs::path> const& _verifiedGenerat
     for (auto const& verifiedTest : _verifiedGeneratedTests)
     {
         auto removed = std::remove_if(compiledTests.begin(), compiledTests.end(),
-            [&verifiedTest](fs::path const& x) { return (x.stem() == verifiedTest.stem());} );
+            [&verifiedTest](fs::path const& x) { return (testFileStem(x) == testFileStem(verifiedTest));} );
         compiledTests.erase(removed, compiledTests.end());
     }
     if (compiledTests.size() > 0)
@@ -193,16 +210,16 @@ void checkGeneratedTestNameCollisions(
     // Fill the names map and check double test names
     if (_testNameFilter.empty())
     {
-        for (auto const& filler : _allTestFillers)
-            getGeneratedTestNames(filler);
+        ThreadManager::runParallel(
+            _allTestFillers.size(), [&_allTestFillers](size_t _i) { getGeneratedTestNames(_allTestFillers.at(_i)); });
     }
     else
     {
         // Check all fillers even if --singletest provided
         std::vector<fs::path> allTestFillers;
         getFillers(_fullPathToFillers, "", allTestFillers);
-        for (auto const& filler : allTestFillers)
-            getGeneratedTestNames(filler);
+        ThreadManager::runParallel(
+            allTestFillers.size(), [&allTestFillers](size_t _i) { getGeneratedTestNames(allTestFillers.at(_i)); });
     }
     checkDoubleGeneratedTestNames();
 }
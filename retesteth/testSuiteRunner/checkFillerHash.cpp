@@ -1,6 +1,7 @@
 #include "EthChecks.h"
 #include "Options.h"
 #include <retesteth/helpers/TestHelper.h>
+#include "FillerHashIndex.h"
 #include "TestSuiteHelperFunctions.h"
 //#include <libdevcore/CommonIO.h>
 
@@ -39,20 +40,19 @@ void checkTestVersion(DataObject const& _info, fs::path const& _compiledTest)
 
 namespace test::testsuite
 {
-bool checkFillerHash(fs::path const& _compiledTest, fs::path const& _sourceTest)
+bool checkFillerHash(fs::path const& _compiledTest, fs::path const& _sourceTest, FillerHashIndex& _index)
 {
     bool isTestOutdated = false;
     ETH_DC_MESSAGE(DC::TESTLOG, string("Check `") + _compiledTest.c_str() + "` hash");
     ETH_DC_MESSAGE(DC::TESTLOG, string("SrcFile `") + _sourceTest.c_str() + "`");
-    TestFileData fillerData = readFillerTestFile(_sourceTest);
+    TestFileData const fillerData = _index.filler(_sourceTest);
 
     // If no hash calculated, skip the hash check
     if (!fillerData.hashCalculated)
         return isTestOutdated;
 
-    CJOptions opt { .stopper = "_info" };
-    spDataObject compiledTestFileData = test::readJsonData(_compiledTest, opt);
-    for (auto const& test : compiledTestFileData->getSubObjects())
+    spDataObject const filledTests = _index.filled(_compiledTest);
+    for (auto const& test : filledTests->getSubObjects())
     {
         DataObject const& testRef = test.getCContent();
         try
@@ -1,3 +1,4 @@
+#include <retesteth/helpers/CompressedFile.h>
 #include <retesteth/helpers/TestHelper.h>
 #include <retesteth/helpers/TestOutputHelper.h>
 #include "TestSuiteHelperFunctions.h"
@@ -23,14 +24,14 @@ namespace
 {
 void checkFileIsFiller(fs::path const& _file)
 {
-    string fileName = _file.stem().c_str();
+    string fileName = testFileStem(_file);
     if (fileName.find("Filler") == string::npos)
         ETH_ERROR_MESSAGE("Trying to fill `" + string(_file.c_str()) + "`, but file does not have Filler suffix!");
 }
 
 fs::path prepareOutputFileName(fs::path const& _file)
 {
-    string fileName = _file.stem().c_str();
+    string fileName = testFileStem(_file);
 
     // output filename. substract Filler suffix
     fileName = fileName.substr(0, fileName.length() - 6) + ".json";
@@ -60,7 +61,7 @@ void updatePythonTestInfo(TestFileData& _testData, fs::path const& _pythonFiller
         if (update)
         {
             (*output).performModifier(mod_sortKeys, DataObject::ModifierOption::NONRECURSIVE);
-            writeFile(outputTestFilePath, asBytes(output->asJson()));
+            writeTestFile(outputTestFilePath, output->asJson());
         }
     }
 }
@@ -80,7 +81,7 @@ bool TestSuite::_fillPython(TestFileData& _testData, fs::path const& _fillerTest
     auto const& specsScript = currentConfig.getPySpecsStartScript();
     if (fs::exists(specsScript))
     {
-        string const fillerName = _fillerTestFilePath.stem().string();
+        string const fillerName = testFileStem(_fillerTestFilePath);
         TestOutputHelper::get().setCurrentTestName(fillerName);
 
         /*
@@ -139,9 +140,8 @@ void TestSuite::_fillCopier(
     ETH_DC_MESSAGE(DC::TESTLOG, " TO " + _outputTestFilePath.path().string());
     assert(_fillerTestFilePath.string() != _outputTestFilePath.path().string());
     addClientInfoIfUpdate(_testData.data.getContent(), _fillerTestFilePath, _testData.hash, _outputTestFilePath.path());
-    writeFile(_outputTestFilePath.path(), asBytes(_testData.data->asJson()));
-    ETH_FAIL_REQUIRE_MESSAGE(
-        boost::filesystem::exists(_outputTestFilePath.path().string()), "Error when copying the test file!");
+    fs::path const outputFile = writeTestFile(_outputTestFilePath.path(), _testData.data->asJson());
+    ETH_FAIL_REQUIRE_MESSAGE(boost::filesystem::exists(outputFile), "Error when copying the test file!");
 }
 
 bool TestSuite::_fillJsonYml(TestFileData& _testData, fs::path const& _fillerTestFilePath,
@@ -159,7 +159,7 @@ bool TestSuite::_fillJsonYml(TestFileData& _testData, fs::path const& _fillerTes
             if (update)
             {
                 (*output).performModifier(mod_sortKeys, DataObject::ModifierOption::NONRECURSIVE);
-                writeFile(_outputTestFilePath.path(), asBytes(output->asJson()));
+                writeTestFile(_outputTestFilePath.path(), output->asJson());
             }
         }
         wereErrors = false;
@@ -193,7 +193,7 @@ bool TestSuite::_fillTest(TestSuite::TestSuiteOptions& _opt, fs::path const& _fi
     TestFileData testData = readFillerTestFile(_fillerTestFilePath);
 
     bool const isPy = (_fillerTestFilePath.extension() == ".py");
-    bool const isCopier = (_fillerTestFilePath.stem().string().rfind(c_copierPostf) != string::npos);
+    bool const isCopier = (testFileStem(_fillerTestFilePath).rfind(c_copierPostf) != string::npos);
     if (isPy)
         return _fillPython(testData, _fillerTestFilePath, _outputTestFilePath);
 
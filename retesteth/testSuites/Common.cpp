@@ -1,5 +1,6 @@
 #include "Common.h"
 #include <retesteth/Options.h>
+#include <retesteth/helpers/CompressedFile.h>
 #include <retesteth/helpers/TestHelper.h>
 #include <retesteth/helpers/TestOutputHelper.h>
 #include <retesteth/Constants.h>
@@ -45,7 +46,7 @@ void checkTestNameIsEqualToFileName(string const& _testName)
 {
     if (!TestOutputHelper::get().testFile().empty())
     {
-        const string tFileName = TestOutputHelper::get().testFile().stem().string();
+        const string tFileName = testFileStem(TestOutputHelper::get().testFile());
         ETH_ERROR_REQUIRE_MESSAGE(_testName + "Filler" == tFileName,
             TestOutputHelper::get().testFile().string() +
                 " contains a test with a different name '" + _testName + "'");
@@ -59,7 +60,7 @@ void checkTestNameIsEqualToFileName(DataObject const& _input)
         auto const& testfile = TestOutputHelper::get().testFile();
         auto const& key = _input.getSubObjects().at(0)->getKey();
         ETH_ERROR_REQUIRE_MESSAGE(
-             key + "Filler" == testfile.stem().string(),
+             key + "Filler" == testFileStem(testfile),
             testfile.string() + " contains a test with a different name '" + key + "'");
     }
 }
@@ -1,6 +1,7 @@
 #include "Common.h"
 #include <retesteth/Options.h>
 #include <retesteth/helpers/TestOutputHelper.h>
+#include <retesteth/helpers/TraceSpan.h>
 using namespace std;
 using namespace test::debug;
 using namespace test::session;
@@ -83,6 +84,7 @@ spState getRemoteState(SessionInterface& _session)
 // Compare expected state with session asking post state data on the fly
 void compareStates(StateBase const& _stateExpect, SessionInterface& _session)
 {
+    ETH_TRACE_SPAN("compareStates");
     CompareResult result = CompareResult::Success;
 
     VALUE recentBNumber(_session.eth_blockNumber());
@@ -237,6 +239,7 @@ CompareResult compareAccounts(AccountBase const& _expectAccount, State::Account
 // Compare expected state again post state
 void compareStates(StateBase const& _stateExpect, State const& _statePost)
 {
+    ETH_TRACE_SPAN("compareStates");
     CompareResult result = CompareResult::Success;
     for (auto const& ael : _stateExpect.accounts())
     {
@@ -2,6 +2,7 @@
 #include <retesteth/helpers/TestOutputHelper.h>
 #include <retesteth/testStructures/types/EOFTests/EOFTestFiller.h>
 #include <retesteth/testStructures/types/EOFTests/EOFTest.h>
+#include <retesteth/testStructures/types/EOFTests/EOFContainer.h>
 #include <retesteth/testSuites/Common.h>
 #include <retesteth/Options.h>
 #include <retesteth/session/SessionInterface.h>
@@ -12,42 +13,162 @@
 using namespace std;
 using namespace test;
 using namespace test::session;
+using namespace test::debug;
 using namespace test::teststruct;
 using namespace dataobject;
 namespace fs = boost::filesystem;
 
+namespace
+{
+// EOF codes to validate on one fork and the slots for their results
+struct EOFForkBatch
+{
+    std::vector<BYTES const*> codes;
+    std::vector<string*> results;
+};
+typedef std::map<FORK, EOFForkBatch> EOFBatches;
+
+// Client reason of the header error found by retesteth, empty if the code has to be validated by the client
+string nativeEOFResult(BYTES const& _code)
+{
+    string const exception = validateEOFHeader(dev::fromHex(_code.asString()));
+    auto const& exceptions = Options::getCurrentConfig().cfgFile().exceptions();
+    if (exception.empty() || !exceptions.count(exception))
+        return string();
+    return exceptions.at(exception);
+}
+
+// With _useNative the codes rejected by the header check are not sent to the client
+void validateEOFCodes(SessionInterface& _session, FORK const& _fork, EOFForkBatch const& _batch, bool _useNative)
+{
+    bool const crossCheck = Options::get().eofcrosscheck;
+    std::vector<string> native(_batch.codes.size());
+    std::vector<size_t> clientCodes;
+    std::vector<size_t> nativeCodes;
+    bool hasCalibration = false;
+    for (size_t i = 0; i < _batch.codes.size(); i++)
+    {
+        if (_useNative || crossCheck)
+            native.at(i) = nativeEOFResult(*_batch.codes.at(i));
+        // The client confirms one native result per fork, EOF rules might be not active on the fork
+        bool const calibration = !native.at(i).empty() && !hasCalibration;
+        hasCalibration = hasCalibration || calibration;
+        if (native.at(i).empty() || crossCheck || calibration || !_useNative)
+            clientCodes.emplace_back(i);
+        else
+            nativeCodes.emplace_back(i);
+    }
+
+    bool nativeConfirmed = true;
+    auto runClient = [&](std::vector<size_t> const& _codes) {
+        if (_codes.empty())
+            return;
+        std::vector<BYTES> codes;
+        codes.reserve(_codes.size());
+        for (size_t i : _codes)
+            codes.emplace_back(_batch.codes.at(i)->asString());
+        std::vector<string> const res = _session.test_rawEOFCodes(codes, _fork);
+        ETH_ERROR_REQUIRE_MESSAGE(res.size() == codes.size(), "test_rawEOFCodes returned " + test::fto_string(res.size()) +
+                                                                  " results for " + test::fto_string(codes.size()) + " codes!");
+        for (size_t j = 0; j < _codes.size(); j++)
+        {
+            size_t const i = _codes.at(j);
+            *_batch.results.at(i) = res.at(j);
+            if (!native.at(i).empty() && res.at(j).find(native.at(i)) == string::npos)
+            {
+                nativeConfirmed = false;
+                if (crossCheck)
+                    ETH_ERROR_MESSAGE("EOF header check differs from the client on " + _fork.asString() + ": (" +
+                                      codes.at(j).asString() + ")\nRetesteth: " + native.at(i) + "\nClient: " + res.at(j));
+            }
+        }
+    };
+
+    runClient(clientCodes);
+    if (nativeConfirmed)
+    {
+        for (size_t i : nativeCodes)
+            *_batch.results.at(i) = native.at(i);
+        if (nativeCodes.size())
+            ETH_DC_MESSAGE(DC::TESTLOG, _fork.asString() + ": " + test::fto_string(nativeCodes.size()) + " of " +
+                                            test::fto_string(native.size()) + " EOF codes rejected by header check");
+    }
+    else
+    {
+        ETH_DC_MESSAGE(DC::TESTLOG, _fork.asString() + ": client does not confirm EOF header check, validating all codes with the client");
+        runClient(nativeCodes);
+    }
+}
+
+// Validate the codes with one client call per fork
+void validateEOFCodes(EOFBatches const& _batches, bool _useNative)
+{
+    SessionInterface& session = RPCSession::instance(TestOutputHelper::getThreadID());
+    for (auto const& [fork, batch] : _batches)
+    {
+        if (ExitHandler::receivedExitSignal())
+            break;
+        TestOutputHelper::get().setCurrentTestInfo(TestInfo("EOF code validation on " + fork.asString()));
+        validateEOFCodes(session, fork, batch, _useNative);
+    }
+}
+
 spDataObject FillTest(EOFTestInFiller const& _test)
 {
     spDataObject filledTest;
     TestOutputHelper::get().setCurrentTestName(_test.testName());
-    SessionInterface& session = RPCSession::instance(TestOutputHelper::getThreadID());
     if (_test.hasInfo())
         (*filledTest).atKeyPointer("_info") = _test.Info().rawData();
     (*filledTest).atKeyPointer("vectors") = sDataObject(DataType::Object);
 
-    size_t dataInd = 0;
-    for (auto const& testVector : _test.Vectors())
+    std::vector<FORK> forks;
+    for (auto const& fork : _test.Forks())
     {
+        if (!networkSkip(fork, _test.testName()))
+            forks.emplace_back(fork);
+    }
+
+    auto const& dataOpt = Options::get().trData;
+    auto const vectorSkipped = [&dataOpt](size_t _dataInd) {
+        return dataOpt.initialized() && dataOpt.index != -1 && (size_t)dataOpt.index != _dataInd;
+    };
+
+    std::vector<EOFTestVectorInFiller> const vectors = _test.Vectors();
+    std::vector<std::map<FORK, string>> results(vectors.size());
+    EOFBatches batches;
+    for (size_t dataInd = 0; dataInd < vectors.size(); dataInd++)
+    {
+        if (vectorSkipped(dataInd))
+            continue;
+        for (auto const& fork : forks)
+        {
+            batches[fork].codes.emplace_back(&vectors.at(dataInd).data());
+            batches[fork].results.emplace_back(&results.at(dataInd)[fork]);
+        }
+    }
+    // Filling takes the header errors from retesteth, the filled tests are run on the client only
+    validateEOFCodes(batches, true);
+
+    for (size_t dataInd = 0; dataInd < vectors.size(); dataInd++)
+    {
+        auto const& testVector = vectors.at(dataInd);
         spDataObject vectorOut;
         (*vectorOut).setKey(_test.testName() + "_" + test::fto_string(dataInd));
         (*vectorOut)["code"] = testVector.data().asString();
         (*vectorOut).atKeyPointer("results") = sDataObject(DataType::Object);
-        for(auto const& fork : _test.Forks())
+        for (auto const& fork : forks)
         {
-            if (networkSkip(fork, _test.testName()))
-                continue;
+            if (ExitHandler::receivedExitSignal() || vectorSkipped(dataInd))
+                break;
 
             spDataObject forkResult;
             (*forkResult).setKey(fork.asString());
-            auto const& dataOpt = Options::get().trData;
-            if (dataOpt.initialized() && dataOpt.index != -1 && (size_t)dataOpt.index != dataInd)
-                continue;
 
             TestInfo errorInfo(fork.asString(), (int)dataInd, -1, -1);
             errorInfo.setTrDataDebug(testVector.dataPreview());
             TestOutputHelper::get().setCurrentTestInfo(errorInfo);
 
-            string res = session.test_rawEOFCode(testVector.data(), fork);
+            string const& res = results.at(dataInd).at(fork);
             string const& testException = testVector.getExpectException(fork);
             compareEOFException(testVector.data(), res, testException);
             if (testException.empty())
@@ -61,7 +182,6 @@ spDataObject FillTest(EOFTestInFiller const& _test)
             (*vectorOut)["results"].addSubObject(forkResult);
         }
         (*filledTest)["vectors"].addSubObject(vectorOut);
-        dataInd++;
     }
     return filledTest;
 }
@@ -72,21 +192,40 @@ void RunTest(EOFTestInFilled const& _test)
         return;
 
     TestOutputHelper::get().setCurrentTestName(_test.testName());
-    SessionInterface& session = RPCSession::instance(TestOutputHelper::getThreadID());
+
+    std::map<FORK, bool> forkSkipped;
+    std::map<string, std::map<FORK, string>> results;
+    EOFBatches batches;
+    for (auto const& [vectorName, vec] : _test.getVectors())
+    {
+        for (auto const& [fork, exception] : vec.getResultForks())
+        {
+            (void)exception;
+            if (!forkSkipped.count(fork))
+                forkSkipped.emplace(fork, networkSkip(fork, _test.testName()));
+            if (forkSkipped.at(fork))
+                continue;
+            batches[fork].codes.emplace_back(&vec.data());
+            batches[fork].results.emplace_back(&results[vectorName][fork]);
+        }
+    }
+    validateEOFCodes(batches, Options::get().eofnativecheck);
 
     for (auto const& [vectorName, vec] : _test.getVectors())
     {
         for (auto const& [fork, exception] : vec.getResultForks())
         {
-            if (networkSkip(fork, _test.testName()))
+            if (ExitHandler::receivedExitSignal())
+                return;
+            if (forkSkipped.at(fork))
                 continue;
 
             TestOutputHelper::get().setCurrentTestInfo(TestInfo(vectorName + "/" + fork.asString()));
-            string const res = session.test_rawEOFCode(vec.data(), fork);
-            compareEOFException(vec.data(), res, exception);
+            compareEOFException(vec.data(), results.at(vectorName).at(fork), exception);
         }
     }
 }
+}  // namespace
 
 spDataObject EOFTestSuite::doTests(spDataObject& _input, TestSuiteOptions& _opt) const
 {
@@ -206,7 +206,7 @@ void TestFixture<T, U>::_execute(std::set<TestExecution> const& _execFlags) cons
     }
 
     std::string const casename = boost::unit_test::framework::current_test_case().p_name;
-    boost::filesystem::path const suiteFillerPath = m_suite.getFullPathFiller(casename).parent_path();
+    boost::filesystem::path const suiteFillerPath = m_suite->getFullPathFiller(casename).parent_path();
 
     // skip wallet test as it takes too much time (250 blocks) run it with --all flag
     if ((TestChecker::isTimeConsumingTest(casename) || allFlags.count(TestExecution::RequireOptionAll))
@@ -233,8 +233,10 @@ void TestFixture<T, U>::_execute(std::set<TestExecution> const& _execFlags) cons
         return;
     }
 
-    m_suite.runAllTestsInFolder(casename);
-    test::TestOutputHelper::get().markTestFolderAsFinished(suiteFillerPath, casename);
+    auto const markFinished = [suiteFillerPath, casename]() {
+        test::TestOutputHelper::markTestFolderAsFinished(suiteFillerPath, casename);
+    };
+    m_suite->runAllTestsInFolder(casename, markFinished, m_suite);
 }
 
 template <class T, class U>
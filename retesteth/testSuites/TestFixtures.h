@@ -94,17 +94,23 @@ class TestFixture : public TestFixtureBase
 public:
     TestFixture(std::set<TestExecution> const& _execFlags = {});
     TestFixture(int){};
-    std::string folder() const override { return m_suite.suiteFolder().path().string(); }
-    std::string fillerFoler() const override { return m_suite.suiteFillerFolder().path().string(); }
-    void setAdditionalFillerFolder(std::string&& _folder) const override { m_suite.setFillerPathAdd(std::move(_folder)); };
-    TestFixtureBase* copy() const override { return new TestFixture<T, U>(*this); }
+    std::string folder() const override { return m_suite->suiteFolder().path().string(); }
+    std::string fillerFoler() const override { return m_suite->suiteFillerFolder().path().string(); }
+    void setAdditionalFillerFolder(std::string&& _folder) const override { m_suite->setFillerPathAdd(std::move(_folder)); };
+    TestFixtureBase* copy() const override
+    {
+        // The copy gets its own filler folder, so it must not share the suite
+        auto* fixture = new TestFixture<T, U>(*this);
+        fixture->m_suite = std::make_shared<T>(*m_suite);
+        return fixture;
+    }
     void execute() const override { _execute(m_execFlags); }
     ~TestFixture() override {}
 
 private:
     void _execute(std::set<TestExecution> const& _execFlags) const;
     std::set<TestExecution> m_execFlags;
-    T m_suite;
+    std::shared_ptr<T> m_suite = std::make_shared<T>();  // shared with the --globalqueue tasks
 };
 
 
@@ -3,12 +3,17 @@
 #include <libdevcore/CommonIO.h>
 #include <libdevcore/SHA3.h>
 #include <retesteth/ExitHandler.h>
+#include <retesteth/helpers/TestHelper.h>
 #include <retesteth/helpers/TestOutputHelper.h>
 #include <retesteth/testStructures/types/Ethereum/Transactions/TransactionLegacy.h>
 #include <retesteth/testStructures/types/TransactionTests/TransactionTest.h>
 #include <retesteth/testStructures/types/TransactionTests/TransactionTestFiller.h>
 #include <retesteth/testSuites/Common.h>
+#include <retesteth/testSuiteRunner/TestFileCache.h>
+#include <retesteth/helpers/CompressedFile.h>
+#include <retesteth/session/ThreadManager.h>
 #include <retesteth/Options.h>
+#include <mutex>
 
 using namespace std;
 using namespace test;
@@ -16,34 +21,222 @@ using namespace test::session;
 namespace fs = boost::filesystem;
 namespace
 {
-spDataObject FillTest(TransactionTestInFiller const& _test)
+typedef std::map<FORK, TestRawTransaction> ForkResults;
+
+// Transaction vectors of the tests, a vector with no forks is not checked
+struct Vectors
 {
-    spDataObject filledTest;
-    TestOutputHelper::get().setCurrentTestName(_test.testName());
+    std::vector<string> names;
+    std::vector<BYTES> rlps;
+    std::vector<std::vector<FORK>> forks;
+};
 
-    SessionInterface& session = RPCSession::instance(TestOutputHelper::getThreadID());
+// Results of the folder prefetch by config id, fork and transaction rlp. A result is taken once
+std::mutex g_prefetchedMutex;
+std::map<string, TestRawTransaction> g_prefetched;
 
-    if (_test.hasInfo())
-        (*filledTest).atKeyPointer("_info") = _test.info().rawData();
+string prefetchKey(FORK const& _fork, BYTES const& _rlp)
+{
+    return test::fto_string(Options::getCurrentConfig().getId().id()) + ":" + _fork.asString() + ":" + _rlp.asString();
+}
+
+// Forks of the test that are run on the current client
+std::vector<FORK> runForks(std::set<FORK> const& _forks, string const& _testName)
+{
+    std::vector<FORK> forks;
+    for (auto const& fork : _forks)
+    {
+        if (!networkSkip(fork, _testName))
+            forks.emplace_back(fork);
+    }
+    return forks;
+}
 
-    std::set<FORK> executionForks;
+// Same forks as runForks without the skip warnings, the tests print them when they run
+std::vector<FORK> prefetchForks(std::set<FORK> const& _forks)
+{
+    auto const& opt = Options::get();
+    auto const& conf = opt.getCurrentConfig();
+    std::vector<FORK> forks;
+    for (auto const& fork : _forks)
+    {
+        bool allowed = conf.checkForkAllowed(fork) && !conf.checkForkSkipOnFiller(fork);
+        if (opt.runOnlyNets.initialized())
+            allowed = allowed && Options::getDynamicOptions().runOnlyNetworks().count(fork);
+        else if (!opt.singleTestNet.empty())
+            allowed = allowed && opt.singleTestNet == fork.asString();
+        if (allowed)
+            forks.emplace_back(fork);
+    }
+    return forks;
+}
+
+std::set<FORK> fillForks(TransactionTestInFiller const& _test)
+{
+    std::set<FORK> forks;
     for (auto const& fork : Options::getCurrentConfig().cfgFile().forks())
-        executionForks.emplace(fork);
+        forks.emplace(fork);
     for (auto const& fork : _test.additionalForks())
-        executionForks.emplace(fork);
-    if (hasSkipFork(executionForks))
-        return spDataObject(new DataObject(DataType::Null));
+        forks.emplace(fork);
+    return forks;
+}
+
+void unmarkErrorsSince(size_t _errorsBefore)
+{
+    while (TestOutputHelper::get().getErrors().size() > _errorsBefore)
+        TestOutputHelper::get().unmarkLastError();
+}
+
+// Check the transactions with one session call, returns nothing if the call has failed
+// The errors of the failed call are unmarked, a caller reports them for the vector that caused them
+std::vector<TestRawTransaction> batchTransactions(std::vector<BYTES> const& _rlps, FORK const& _fork)
+{
+    SessionInterface& session = RPCSession::instance(TestOutputHelper::getThreadID());
+    size_t const errorsBefore = TestOutputHelper::get().getErrors().size();
+    try
+    {
+        std::vector<TestRawTransaction> res = session.test_rawTransactions(_rlps, _fork);
+        ETH_ERROR_REQUIRE_MESSAGE(res.size() == _rlps.size(), "test_rawTransactions returned " + test::fto_string(res.size()) +
+                                                                   " results for " + test::fto_string(_rlps.size()) + " transactions!");
+        return res;
+    }
+    catch (test::EthError const&)
+    {
+        unmarkErrorsSince(errorsBefore);
+    }
+    return std::vector<TestRawTransaction>();
+}
+
+// Check the transactions of all tests with one session call per fork, prefetched results are reused
+// If a call fails the transactions are checked one by one, so each error is reported under its own test
+std::vector<ForkResults> performTransactions(Vectors const& _vectors)
+{
+    std::map<FORK, std::vector<size_t>> testsByFork;
+    std::vector<ForkResults> results(_vectors.rlps.size());
+    {
+        std::lock_guard<std::mutex> lock(g_prefetchedMutex);
+        for (size_t i = 0; i < _vectors.forks.size(); i++)
+        {
+            for (auto const& fork : _vectors.forks.at(i))
+            {
+                auto const it = g_prefetched.find(prefetchKey(fork, _vectors.rlps.at(i)));
+                if (it == g_prefetched.end())
+                    testsByFork[fork].emplace_back(i);
+                else
+                {
+                    results.at(i).emplace(fork, it->second);
+                    g_prefetched.erase(it);
+                }
+            }
+        }
+    }
+
+    SessionInterface& session = RPCSession::instance(TestOutputHelper::getThreadID());
+    for (auto const& [fork, tests] : testsByFork)
+    {
+        if (ExitHandler::receivedExitSignal())
+            break;
+
+        std::vector<BYTES> rlps;
+        rlps.reserve(tests.size());
+        for (size_t i : tests)
+            rlps.emplace_back(_vectors.rlps.at(i).asString());
+        std::vector<TestRawTransaction> const res = batchTransactions(rlps, fork);
+        if (res.size() == tests.size())
+        {
+            for (size_t j = 0; j < tests.size(); j++)
+                results.at(tests.at(j)).emplace(fork, res.at(j));
+            continue;
+        }
 
+        for (size_t i : tests)
+        {
+            if (ExitHandler::receivedExitSignal())
+                break;
+            TestOutputHelper::get().setCurrentTestName(_vectors.names.at(i));
+            try
+            {
+                results.at(i).emplace(fork, session.test_rawTransaction(_vectors.rlps.at(i), fork));
+            }
+            catch (test::EthError const&)
+            {
+                // The error is marked under the test of the vector, its other forks are still checked
+            }
+        }
+    }
+    return results;
+}
+
+// Check the vectors of all test files of a folder with one session call per fork
+void prefetchTransactions(TestSuite const& _suite, string const& _testFolder, std::vector<fs::path> const& _fillers)
+{
+    TestOutputHelper::get().setCurrentTestInfo(TestInfo("TransactionTestSuite::prepareTests"));
+    RPCSession::sessionStart(TestOutputHelper::getThreadID());
+    std::map<FORK, std::vector<BYTES>> rlpsByFork;
+    for (auto const& filler : _fillers)
+    {
+        if (ExitHandler::receivedExitSignal())
+            break;
+        size_t const errorsBefore = TestOutputHelper::get().getErrors().size();
+        try
+        {
+            if (Options::get().filltests)
+            {
+                spDataObject data = testsuite::readFillerTestFile(filler).data;
+                testsuite::removeComments(data);
+                TransactionTestFiller const test(data);
+                for (auto const& el : test.tests())
+                    for (auto const& fork : prefetchForks(fillForks(el)))
+                        rlpsByFork[fork].emplace_back(el.transaction()->getRawBytes().asString());
+            }
+            else
+            {
+                fs::path const filledFolder = _suite.getFullPathFilled(_testFolder).path();
+                for (auto const& name : testsuite::getGeneratedTestNames(filler))
+                {
+                    spDataObject data = testsuite::TestFileCache::get().readJson(findTestFile(filledFolder / (name + ".json")));
+                    TransactionTest const test(data);
+                    for (auto const& el : test.tests())
+                        for (auto const& fork : prefetchForks(el.allForks()))
+                            rlpsByFork[fork].emplace_back(el.rlp().asString());
+                }
+            }
+        }
+        catch (std::exception const&)
+        {
+            // The test reports the broken file when it runs
+            unmarkErrorsSince(errorsBefore);
+        }
+    }
 
-    for (auto const& fork : executionForks)
+    for (auto const& [fork, rlps] : rlpsByFork)
     {
         if (ExitHandler::receivedExitSignal())
             break;
+        std::vector<TestRawTransaction> const res = batchTransactions(rlps, fork);
+        std::lock_guard<std::mutex> lock(g_prefetchedMutex);
+        for (size_t i = 0; i < res.size(); i++)
+            g_prefetched.emplace(prefetchKey(fork, rlps.at(i)), res.at(i));
+    }
+    RPCSession::sessionEnd(TestOutputHelper::getThreadID(), RPCSession::SessionStatus::HasFinished);
+}
 
-        if (networkSkip(fork, _test.testName()))
+spDataObject FillTest(TransactionTestInFiller const& _test, std::vector<FORK> const& _forks, ForkResults const& _results)
+{
+    spDataObject filledTest;
+    TestOutputHelper::get().setCurrentTestName(_test.testName());
+
+    if (_test.hasInfo())
+        (*filledTest).atKeyPointer("_info") = _test.info().rawData();
+
+    for (auto const& fork : _forks)
+    {
+        if (ExitHandler::receivedExitSignal())
+            break;
+        if (!_results.count(fork))
             continue;
 
-        TestRawTransaction res = session.test_rawTransaction(_test.transaction()->getRawBytes(), fork);
+        TestRawTransaction const& res = _results.at(fork);
         compareTransactionException(_test.transaction(), res, _test.getExpectException(fork));
 
         spDataObject result;
@@ -63,19 +256,17 @@ spDataObject FillTest(TransactionTestInFiller const& _test)
     return filledTest;
 }
 
-void RunTest(TransactionTestInFilled const& _test)
+void RunTest(TransactionTestInFilled const& _test, std::vector<FORK> const& _forks, ForkResults const& _results)
 {
     TestOutputHelper::get().setCurrentTestName(_test.testName());
-    SessionInterface& session = RPCSession::instance(TestOutputHelper::getThreadID());
-    for (auto const& fork : _test.allForks())
+    for (auto const& fork : _forks)
     {
         if (ExitHandler::receivedExitSignal())
             break;
-
-        if (networkSkip(fork, _test.testName()))
+        if (!_results.count(fork))
             continue;
 
-        TestRawTransaction res = session.test_rawTransaction(_test.rlp(), fork);
+        TestRawTransaction const& res = _results.at(fork);
         if (_test.transaction().isEmpty())
         {
             // Retesteth was unable to read the transaction rlp from the test into a valid transaction
@@ -126,11 +317,31 @@ spDataObject TransactionTestSuite::doTests(spDataObject& _input, TestSuiteOption
         spDataObject filledTest;
         TransactionTestFiller filler(_input);
 
+        Vectors vectors;
+        std::vector<bool> skipped;
         for (auto const& test : filler.tests())
+        {
+            TestOutputHelper::get().setCurrentTestName(test.testName());
+            std::set<FORK> const executionForks = fillForks(test);
+            skipped.emplace_back(hasSkipFork(executionForks));
+            vectors.names.emplace_back(test.testName());
+            vectors.rlps.emplace_back(test.transaction()->getRawBytes().asString());
+            vectors.forks.emplace_back(skipped.back() ? std::vector<FORK>() : runForks(executionForks, test.testName()));
+        }
+        size_t const errorsBefore = TestOutputHelper::get().getErrors().size();
+        std::vector<ForkResults> const results = performTransactions(vectors);
+        if (TestOutputHelper::get().getErrors().size() > errorsBefore)
+            throw test::EthError("Transaction vectors have failed");  // Do not write a filled test without results
+
+        for (size_t i = 0; i < filler.tests().size(); i++)
         {
             if (ExitHandler::receivedExitSignal())
                 break;
-            (*filledTest).addSubObject(test.testName(), FillTest(test));
+            auto const& test = filler.tests().at(i);
+            if (skipped.at(i))
+                (*filledTest).addSubObject(test.testName(), spDataObject(new DataObject(DataType::Null)));
+            else
+                (*filledTest).addSubObject(test.testName(), FillTest(test, vectors.forks.at(i), results.at(i)));
             TestOutputHelper::get().registerTestRunSuccess();
         }
         return filledTest;
@@ -147,11 +358,21 @@ spDataObject TransactionTestSuite::doTests(spDataObject& _input, TestSuiteOption
             return spDataObject();
         }
 
+        Vectors vectors;
         for (auto const& test : filledTest.tests())
+        {
+            TestOutputHelper::get().setCurrentTestName(test.testName());
+            vectors.names.emplace_back(test.testName());
+            vectors.rlps.emplace_back(test.rlp().asString());
+            vectors.forks.emplace_back(runForks(test.allForks(), test.testName()));
+        }
+        std::vector<ForkResults> const results = performTransactions(vectors);
+
+        for (size_t i = 0; i < filledTest.tests().size(); i++)
         {
             if (ExitHandler::receivedExitSignal())
                 break;
-            RunTest(test);
+            RunTest(filledTest.tests().at(i), vectors.forks.at(i), results.at(i));
             TestOutputHelper::get().registerTestRunSuccess();
         }
     }
@@ -159,6 +380,19 @@ spDataObject TransactionTestSuite::doTests(spDataObject& _input, TestSuiteOption
     return spDataObject();
 }
 
+void TransactionTestSuite::prepareTests(string const& _testFolder, std::vector<fs::path> const& _testFillers) const
+{
+    // Only the transition tool checks many transactions with one call
+    auto const& opt = Options::get();
+    if (opt.checkhash || opt.getvectors || opt.singletest.initialized() ||
+        Options::getCurrentConfig().cfgFile().socketType() != ClientConfgSocketType::TransitionTool)
+        return;
+
+    auto job = [this, &_testFolder, &_testFillers]() { prefetchTransactions(*this, _testFolder, _testFillers); };
+    ThreadManager::addTask(job);
+    ThreadManager::joinThreads();
+}
+
 /// TEST SUITE ///
 
 TestSuite::TestPath TransactionTestSuite::suiteFolder() const
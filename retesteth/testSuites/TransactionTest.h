@@ -30,6 +30,7 @@ class TransactionTestSuite : public TestSuite
 public:
     TransactionTestSuite(){};
     dataobject::spDataObject doTests(dataobject::spDataObject& _input, TestSuiteOptions& _opt) const override;
+    void prepareTests(std::string const& _testFolder, std::vector<boost::filesystem::path> const& _testFillers) const override;
     TestSuite::TestPath suiteFolder() const override;
     TestSuite::FillerPath suiteFillerFolder() const override;
 };
@@ -3,6 +3,7 @@
 #include <retesteth/EthChecks.h>
 #include <retesteth/ExitHandler.h>
 #include <retesteth/Options.h>
+#include <retesteth/helpers/CompressedFile.h>
 #include <retesteth/helpers/TestOutputHelper.h>
 using namespace std;
 using namespace test;
@@ -57,7 +58,7 @@ spDataObject DoTests(spDataObject& _input, TestSuite::TestSuiteOptions& _opt)
         BlockchainTestFiller testFiller(_input);
 
         // Test Name Warning
-        string const tFileName = TestOutputHelper::get().testFile().stem().string();
+        string const tFileName = testFileStem(TestOutputHelper::get().testFile());
         string const tObjectName = testFiller.tests().at(0).testName() + "Filler";
         if (tObjectName != tFileName)
             ETH_WARNING("Blockchain test filler first test name is not equal test filename! (" + tObjectName +
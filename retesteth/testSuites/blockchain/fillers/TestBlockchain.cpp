@@ -250,7 +250,9 @@ FH32 TestBlockchain::postmineBlockHeader(BlockchainTestFillerBlock const& _block
     // if blockHeader is defined in test Filler, rewrite the last block header fields with info from
     // test and reimport it to the client in order to trigger an exception in the client
     EthGetBlockBy remoteBlock(m_session.eth_getBlockByNumber(_latestBlockNumber, Request::FULLOBJECTS));
-    EthereumBlock managedBlock(remoteBlock.header());
+
+    // The remote block is shared with the session cache, modify a copy of its header
+    EthereumBlock managedBlock(readBlockHeader(remoteBlock.header()->asDataObject()));
     for (auto const& tr : remoteBlock.transactions())  // + invalid transactions?
         managedBlock.addTransaction(tr->transaction());
 
@@ -27,6 +27,7 @@ spDataObject FillTest(StateTestInFiller const& _test)
             continue;
 
         runner.prepareChainParams(fork);
+        std::vector<StateTestFillerRunner::TransactionOnExpect> units;
         for (auto const& expect : _test.Expects())
         {
             if (expect.hasFork(fork))
@@ -49,7 +50,7 @@ spDataObject FillTest(StateTestInFiller const& _test)
                         continue;
 
                     expectFoundTransaction = true;
-                    runner.performTransactionOnExpect(tr, expect, fork);
+                    units.push_back({&tr, &expect});
                 }
 
                 if (expectFoundTransaction == false)
@@ -60,6 +61,7 @@ spDataObject FillTest(StateTestInFiller const& _test)
             }  // expect has fork
         }
 
+        runner.performTransactions(units, fork);
         runner.registerForkResult();
     }
 
@@ -1,12 +1,14 @@
 #include "StateTestsHelper.h"
 #include "StateTestFillerRunner.h"
 #include <retesteth/session/Session.h>
+#include <retesteth/session/ThreadManager.h>
 #include <retesteth/helpers/TestOutputHelper.h>
 #include <retesteth/testSuites/Common.h>
 #include <retesteth/testStructures/PrepareChainParams.h>
 #include <retesteth/ExitHandler.h>
 #include <retesteth/Options.h>
 #include <libdevcore/CommonIO.h>
+#include <set>
 using namespace std;
 using namespace test;
 using namespace test::debug;
@@ -72,8 +74,8 @@ void StateTestFillerRunner::prepareChainParams(FORK const& _network)
     TestInfo errorInfo("test_setChainParams: " + _network.asString(), m_test.testName());
     TestOutputHelper::get().setCurrentTestInfo(errorInfo);
 
-    auto const p = test::teststruct::prepareChainParams(_network, SealEngine::NoReward, m_test.Pre(), m_test.Env(), ParamsContext::StateTests);
-    m_session.test_setChainParamsNoGenesis(p);
+    m_chainParams = test::teststruct::prepareChainParams(_network, SealEngine::NoReward, m_test.Pre(), m_test.Env(), ParamsContext::StateTests);
+    m_session.test_setChainParamsNoGenesis(m_chainParams);
 }
 
 void StateTestFillerRunner::setErrorInfo(TransactionInGeneralSection const& _tr, FORK const& _network)
@@ -86,18 +88,64 @@ void StateTestFillerRunner::setErrorInfo(TransactionInGeneralSection const& _tr,
 }
 
 void StateTestFillerRunner::performTransactionOnExpect(TransactionInGeneralSection& _tr, StateTestFillerExpectSection const& _expect, FORK const& _network)
+{
+    (*m_forkResults).addArrayObject(performTransaction(m_session, _tr, _expect, _network));
+}
+
+bool StateTestFillerRunner::canSplitTransactions(std::vector<TransactionOnExpect> const& _units) const
+{
+    // Unit test exceptions and debug output are tracked per thread
+    Options const& opt = Options::get();
+    if (_units.size() < 2 || m_test.unitTestExceptions().size() || opt.vmtrace || opt.fillvmtrace || opt.poststate ||
+        opt.statediff)
+        return false;
+
+    // The same transaction under several expect sections is executed in order
+    std::set<TransactionInGeneralSection const*> uniqueTxs;
+    for (auto const& unit : _units)
+        if (!uniqueTxs.emplace(unit.tr).second)
+            return false;
+    return true;
+}
+
+void StateTestFillerRunner::performTransactions(std::vector<TransactionOnExpect> const& _units, FORK const& _network)
+{
+    if (!canSplitTransactions(_units))
+    {
+        for (auto const& unit : _units)
+        {
+            setErrorInfo(*unit.tr, _network);
+            performTransactionOnExpect(*unit.tr, *unit.expect, _network);
+        }
+        return;
+    }
+
+    std::vector<spDataObject> results(_units.size());
+    auto const init = [this](SessionInterface& _session) { _session.test_setChainParamsNoGenesis(m_chainParams); };
+    auto const task = [&](SessionInterface& _session, size_t _i) {
+        setErrorInfo(*_units.at(_i).tr, _network);
+        results.at(_i) = performTransaction(_session, *_units.at(_i).tr, *_units.at(_i).expect, _network);
+    };
+    ThreadManager::runSubTasks(_units.size(), m_session, init, task);
+
+    for (auto const& res : results)
+        (*m_forkResults).addArrayObject(res);
+}
+
+spDataObject StateTestFillerRunner::performTransaction(
+    SessionInterface& _session, TransactionInGeneralSection& _tr, StateTestFillerExpectSection const& _expect, FORK const& _network)
 {
     auto const& ethTr = _tr.transaction();
-    m_session.test_modifyTimestamp(m_test.Env().firstBlockTimestamp());
+    _session.test_modifyTimestamp(m_test.Env().firstBlockTimestamp());
     modifyTransactionChainIDByNetwork(ethTr, _network);
-    FH32 trHash(m_session.eth_sendRawTransaction(ethTr->getRawBytes(), ethTr->getSecret()));
+    FH32 trHash(_session.eth_sendRawTransaction(ethTr->getRawBytes(), ethTr->getSecret()));
 
-    MineBlocksResult const mRes = m_session.test_mineBlocks(1);
+    MineBlocksResult const mRes = _session.test_mineBlocks(1);
     string const& testException = _expect.getExpectException(_network);
     compareTransactionException(ethTr, mRes, testException);
 
-    VALUE latestBlockN(m_session.eth_blockNumber());
-    EthGetBlockBy blockInfo(m_session.eth_getBlockByNumber(latestBlockN, Request::LESSOBJECTS));
+    VALUE latestBlockN(_session.eth_blockNumber());
+    EthGetBlockBy blockInfo(_session.eth_getBlockByNumber(latestBlockN, Request::LESSOBJECTS));
     if (!blockInfo.hasTransaction(trHash) && testException.empty())
         ETH_ERROR_MESSAGE("StateTest::FillTest: " + c_trHashNotFound);
 
@@ -105,21 +153,21 @@ void StateTestFillerRunner::performTransactionOnExpect(TransactionInGeneralSecti
     _tr.assignTransactionHash(trHash);
 
     performPoststate(blockInfo);
-    performStatediff();
-    performVmtrace(blockInfo, _tr, _network);
-    string const vmTraceStr = performVmtraceAnalys(trHash, _expect, _network);
+    performStatediff(_session);
+    performVmtrace(_session, blockInfo, _tr, _network);
+    string const vmTraceStr = performVmtraceAnalys(_session, trHash, _expect, _network);
 
     spDataObject transactionResults;
     try
     {
-        auto const remState = getRemoteState(m_session);
+        auto const remState = getRemoteState(_session);
         compareStates(_expect.result(), remState);
         if (Options::get().poststate)
             (*transactionResults).atKeyPointer("postState") = remState->asDataObject();
     }
     catch (StateTooBig const&)
     {
-        compareStates(_expect.result(), m_session);
+        compareStates(_expect.result(), _session);
     }
 
     spDataObject indexes;
@@ -138,15 +186,15 @@ void StateTestFillerRunner::performTransactionOnExpect(TransactionInGeneralSecti
     // Fill up the loghash (optional)
     if (Options::getDynamicOptions().getCurrentConfig().cfgFile().checkLogsHash())
     {
-        FH32 logHash(m_session.test_getLogHash(trHash));
+        FH32 logHash(_session.test_getLogHash(trHash));
         if (!logHash.isZero())
             (*transactionResults)["logs"] = logHash.asString();
     }
 
-    m_session.test_rewindToBlock(VALUE(0));
+    _session.test_rewindToBlock(VALUE(0));
     ETH_DC_MESSAGE(DC::TESTLOG, "Executed: d: " + to_string(_tr.dataInd()) + ", g: " + to_string(_tr.gasInd()) +
                                     ", v: " + to_string(_tr.valueInd()) + ", fork: " + _network.asString());
-    (*m_forkResults).addArrayObject(transactionResults);
+    return transactionResults;
 }
 
 
@@ -158,35 +206,35 @@ void StateTestFillerRunner::performPoststate(EthGetBlockBy const& _blockInfo)
 }
 
 
-void StateTestFillerRunner::performStatediff()
+void StateTestFillerRunner::performStatediff(SessionInterface& _session)
 {
     if (Options::get().statediff)
     {
-        auto const stateDiffJson = stateDiff(m_test.Pre(), getRemoteState(m_session))->asJson();
+        auto const stateDiffJson = stateDiff(m_test.Pre(), getRemoteState(_session))->asJson();
         ETH_DC_MESSAGE(DC::STATE,
             "\nRunning test State Diff:" + TestOutputHelper::get().testInfo().errorDebug() + cDefault + " \n" + stateDiffJson);
     }
 }
 
-void StateTestFillerRunner::performVmtrace(EthGetBlockBy const& _blockInfo, TransactionInGeneralSection const& _tr, FORK const& _network)
+void StateTestFillerRunner::performVmtrace(SessionInterface& _session, EthGetBlockBy const& _blockInfo, TransactionInGeneralSection const& _tr, FORK const& _network)
 {
     if (Options::get().vmtrace && !Options::get().fillvmtrace)
     {
         string const testNameOut = m_test.testName() + "_d" + _tr.dataIndS() + "g" + _tr.gasIndS() + "v" +
                                    _tr.valueIndS() + "_" + _network.asString() + "_" + _tr.reportedHash().asString() + ".txt";
-        VMtraceinfo info(m_session, _tr.reportedHash(), _blockInfo.header()->stateRoot(), testNameOut);
+        VMtraceinfo info(_session, _tr.reportedHash(), _blockInfo.header()->stateRoot(), testNameOut);
         printVmTrace(info);
     }
 }
 
-string StateTestFillerRunner::performVmtraceAnalys(FH32 const& _trHash, StateTestFillerExpectSection const& _expResult, FORK const& _network)
+string StateTestFillerRunner::performVmtraceAnalys(SessionInterface& _session, FH32 const& _trHash, StateTestFillerExpectSection const& _expResult, FORK const& _network)
 {
     string vmtrace;
     if (Options::get().fillvmtrace)
     {
         if (!_expResult.getExpectException(_network).empty())
             return vmtrace;
-        DebugVMTrace ret(m_session.debug_traceTransaction(_trHash));
+        DebugVMTrace ret(_session.debug_traceTransaction(_trHash));
         for (auto const& log : ret.getLog())
             vmtrace += dev::toCompactHex(log.op);
     }
@@ -14,19 +14,34 @@ public:
     void prepareChainParams(FORK const&);
     void setErrorInfo(TransactionInGeneralSection const& _tr, FORK const& _network);
     void performTransactionOnExpect(TransactionInGeneralSection&, StateTestFillerExpectSection const&, FORK const&);
+
+    // Execute transactions of a fork, split across idle sessions when possible
+    // Results are registered in the given order
+    struct TransactionOnExpect
+    {
+        TransactionInGeneralSection* tr;
+        StateTestFillerExpectSection const* expect;
+    };
+    void performTransactions(std::vector<TransactionOnExpect> const&, FORK const&);
     spDataObject getFilledTest() const { return m_filledTest; }
     void registerForkResult();
 private:
     void fillInfoWithLabels();
+    bool canSplitTransactions(std::vector<TransactionOnExpect> const&) const;
+    spDataObject performTransaction(test::session::SessionInterface&, TransactionInGeneralSection&,
+        StateTestFillerExpectSection const&, FORK const&);
     void performPoststate(EthGetBlockBy const& _blockInfo);
-    void performStatediff();
-    void performVmtrace(EthGetBlockBy const& _blockInfo, TransactionInGeneralSection const& _tr, FORK const& _network);
-    std::string performVmtraceAnalys(FH32 const& _trHash, StateTestFillerExpectSection const& _expResult, FORK const& _network);
+    void performStatediff(test::session::SessionInterface&);
+    void performVmtrace(test::session::SessionInterface&, EthGetBlockBy const& _blockInfo,
+        TransactionInGeneralSection const& _tr, FORK const& _network);
+    std::string performVmtraceAnalys(test::session::SessionInterface&, FH32 const& _trHash,
+        StateTestFillerExpectSection const& _expResult, FORK const& _network);
 private:
     spDataObject m_filledTest;
     spDataObject m_forkResults;
     StateTestInFiller const& m_test;
     test::session::SessionInterface& m_session;
+    spSetChainParamsArgs m_chainParams;
     std::vector<TransactionInGeneralSection> m_txs;
 };
 
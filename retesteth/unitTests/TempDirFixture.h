@@ -0,0 +1,25 @@
+#pragma once
+#include <retesteth/helpers/TestOutputHelper.h>
+#include <boost/filesystem.hpp>
+
+namespace test::unittests
+{
+// A unique folder in the temp directory that is removed with the test case, also when a check throws
+class TempDirFixture : public test::TestOutputHelperFixture
+{
+public:
+    TempDirFixture() : m_tempDir(boost::filesystem::temp_directory_path() / boost::filesystem::unique_path())
+    {
+        boost::filesystem::create_directories(m_tempDir);
+    }
+    ~TempDirFixture()
+    {
+        boost::system::error_code ec;
+        boost::filesystem::remove_all(m_tempDir, ec);
+    }
+    boost::filesystem::path const& tempDir() const { return m_tempDir; }
+
+private:
+    boost::filesystem::path m_tempDir;
+};
+}  // namespace test::unittests
@@ -0,0 +1,40 @@
+#include "TempDirFixture.h"
+#include <retesteth/compiler/CompileCache.h>
+
+using namespace std;
+using namespace test::compiler;
+using namespace test::unittests;
+namespace fs = boost::filesystem;
+
+BOOST_FIXTURE_TEST_SUITE(CompileCacheSuite, TempDirFixture)
+
+BOOST_AUTO_TEST_CASE(compileCache_hitAndEviction)
+{
+    fs::path const dir = tempDir() / "cache";
+    CompileCache cache(dir, 100);
+    size_t compiled = 0;
+    auto compileA = [&compiled]() {
+        compiled++;
+        return string(40, 'a');
+    };
+    BOOST_CHECK_EQUAL(cache.compile("lllc", "{ (STOP) }", compileA), string(40, 'a'));
+    BOOST_CHECK_EQUAL(cache.compile("lllc", "{ (STOP) }", compileA), string(40, 'a'));
+    BOOST_CHECK_EQUAL(compiled, 1);
+
+    // Same source for another compiler is a different entry
+    string output;
+    BOOST_CHECK(!cache.find(CompileCache::key("solc", "{ (STOP) }"), output));
+
+    // Folder is bound by the size limit, the oldest entries are removed
+    for (size_t i = 0; i < 5; i++)
+        cache.insert(CompileCache::key("lllc", to_string(i)), string(40, 'b'));
+    cache.evict();
+    uintmax_t total = 0;
+    for (fs::recursive_directory_iterator it(dir), end; it != end; ++it)
+        if (fs::is_regular_file(it->path()))
+            total += fs::file_size(it->path());
+    BOOST_CHECK(total <= 100);
+    BOOST_CHECK(cache.find(CompileCache::key("lllc", "4"), output));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,56 @@
+#include "TempDirFixture.h"
+#include <libdataobj/ConvertFile.h>
+#include <libdevcore/CommonIO.h>
+#include <retesteth/helpers/CompressedFile.h>
+#include <retesteth/helpers/TestHelper.h>
+
+using namespace std;
+using namespace dev;
+using namespace test;
+using namespace test::unittests;
+using namespace dataobject;
+namespace fs = boost::filesystem;
+
+namespace
+{
+string const c_json = R"({ "test" : { "b" : [1, true, null, "0x01"], "a" : {} } })";
+
+// Write compressed c_json, read it back and check that a truncated file is an error
+void checkCompressedFile(fs::path const& _dir, FileCompression _type)
+{
+    fs::path const file = _dir / ("test.json" + compressionExtension(_type));
+    string const compressed = compressContent(c_json, _type);
+    writeFile(file, bytesConstRef(compressed));
+
+    BOOST_CHECK(findTestFile(_dir / "test.json") == file);
+    BOOST_CHECK_EQUAL(testFileStem(file), "test");
+    BOOST_CHECK(withoutCompression(file).extension() == ".json");
+    spDataObject const data = readJsonData(file);
+    BOOST_CHECK_EQUAL(data->asJson(0, false), ConvertJsoncppStringToData(c_json)->asJson(0, false));
+    BOOST_CHECK(getFiles(_dir, {".json"}).size() == 1);
+
+    // Truncated stream is an error, not a shorter test
+    writeFile(file, bytesConstRef(compressed.substr(0, compressed.size() / 2)));
+    auto const stream = openTestFile(file);
+    string content;
+    BOOST_CHECK_THROW(content.assign(std::istreambuf_iterator<char>(*stream), std::istreambuf_iterator<char>()), std::exception);
+}
+}  // namespace
+
+BOOST_FIXTURE_TEST_SUITE(CompressionSuite, TempDirFixture)
+
+BOOST_AUTO_TEST_CASE(compressedTestFile_gzip)
+{
+    checkCompressedFile(tempDir(), FileCompression::Gzip);
+}
+
+BOOST_AUTO_TEST_CASE(compressedTestFile_zstd)
+{
+#ifdef ZSTD
+    checkCompressedFile(tempDir(), FileCompression::Zstd);
+#else
+    BOOST_CHECK_THROW(compressContent(c_json, FileCompression::Zstd), std::exception);
+#endif
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -18,7 +18,9 @@
  * Unit tests for TestHelper functions.
  */
 
+#include <libdataobj/ConvertBinary.h>
 #include <libdataobj/ConvertFile.h>
+#include <libdataobj/ConvertYaml.h>
 #include <retesteth/helpers/TestOutputHelper.h>
 #include <retesteth/testSuites/Common.h>
 #include <retesteth/testStructures/Common.h>
@@ -1275,4 +1277,99 @@ BOOST_AUTO_TEST_CASE(dataobject_copyFrom_emptyArray)
     }
 }
 
+BOOST_AUTO_TEST_CASE(dataobject_keyReplace)
+{
+    KeyReplaceMap const replace = {{"gasLimit", "gas"}, {"currentNumber", "number"}};
+    string const data = R"({"currentNumber":"0x01","txs":[{"gasLimit":"0x5208","value":"0x00"}]})";
+
+    CJOptions opt;
+    opt.keyReplace = &replace;
+    spDataObject parsed = ConvertJsoncppStringToData(data, opt);
+    BOOST_CHECK(parsed->count("number"));
+    BOOST_CHECK(!parsed->count("currentNumber"));
+    BOOST_CHECK(parsed->atKey("txs").at(0).count("gas"));
+    BOOST_CHECK(parsed->atKey("txs").at(0).count("value"));
+
+    spDataObject orig = ConvertJsoncppStringToData(data);
+    BOOST_CHECK_EQUAL(orig->asJson(0, false, false, &replace), parsed->asJson(0, false));
+    BOOST_CHECK_EQUAL(orig->asJson(0, false, false, nullptr), data);
+}
+
+BOOST_AUTO_TEST_CASE(dataobject_keyReplaceScope)
+{
+    KeyReplaceMap const replace = {{"id", "hash"}, {"number", "blockNumber"}};
+    string const reply = R"({"jsonrpc":"2.0","id":1,"result":{"number":"0x01","id":"0x02","txs":[{"number":"0x03"}]}})";
+
+    CJOptions opt;
+    opt.keyReplace = &replace;
+    opt.keyReplaceScope = "result";
+    spDataObject parsed = ConvertJsoncppStringToData(reply, opt);
+    BOOST_CHECK(parsed->count("id"));
+    BOOST_CHECK(parsed->count("jsonrpc"));
+    DataObject const& result = parsed->atKey("result");
+    BOOST_CHECK(result.count("blockNumber"));
+    BOOST_CHECK(result.count("hash"));
+    BOOST_CHECK(!result.count("id"));
+    BOOST_CHECK(result.atKey("txs").at(0).count("blockNumber"));
+}
+
+BOOST_AUTO_TEST_CASE(dataobject_yamlEvents_sameAsNodeTree)
+{
+    string const yml = R"(
+test:
+  env: &env
+    number: !!int 0x10
+    flag: !!bool true
+    empty:
+    text: "0x01"
+  pre:
+    - *env
+    - [1, 2, ~]
+  zkey: 1
+  akey: *env
+)";
+    for (bool sort : {false, true})
+    {
+        spDataObject const tree = ConvertYamlToData(YAML::Load(yml), sort);
+        spDataObject const events = ConvertYamlStringToData(yml, sort);
+        BOOST_CHECK_EQUAL(tree->asJson(0, false), events->asJson(0, false));
+    }
+    spDataObject const res = ConvertYamlStringToData(yml);
+    BOOST_CHECK(res->atKey("test").atKey("env").atKey("number").type() == DataType::Integer);
+    BOOST_CHECK(res->atKey("test").atKey("env").atKey("empty").type() == DataType::Null);
+    BOOST_CHECK(ConvertYamlStringToData("")->type() == DataType::Null);
+    BOOST_CHECK_THROW(ConvertYamlStringToData("a: 1\nb: 2\na: 3\n"), DataObjectException);
+}
+
+BOOST_AUTO_TEST_CASE(dataobject_binaryRoundTrip)
+{
+    string const data = R"({"b":{"key":"0x01","num":-5,"flag":false,"none":null},"a":[{"key":"v"},[],1]})";
+    spDataObject const obj = ConvertJsoncppStringToData(data);
+    string const binary = ConvertDataToBinary(obj);
+    spDataObject const res = ConvertBinaryToData(binary.data(), binary.size());
+    BOOST_CHECK_EQUAL(res->asJson(0, false), obj->asJson(0, false));
+    BOOST_CHECK(res->atKey("b").atKey("num").asInt() == -5);
+    BOOST_CHECK_THROW(ConvertBinaryToData(binary.data(), binary.size() - 1), DataObjectException);
+    string const uninitialized = ConvertDataToBinary(DataObject());
+    BOOST_CHECK_THROW(ConvertBinaryToData(uninitialized.data(), uninitialized.size()), DataObjectException);
+}
+
+BOOST_AUTO_TEST_CASE(dataobject_streamParse_sameAsString)
+{
+    // Bigger than the stream window, so the parser releases the read data
+    string data = "{\n";
+    for (size_t i = 0; i < 5000; i++)
+        data += "  \"key" + to_string(i) + "\" : { \"v\" : [ " + to_string(i) + ", true, null, \"0x01\" ] },\n";
+    data += "  \"last\" : \"\\\"end\"\n}\n";
+
+    std::istringstream stream(data);
+    spDataObject const streamed = ConvertJsonStreamToData(stream);
+    spDataObject const parsed = ConvertJsoncppStringToData(data);
+    BOOST_CHECK_EQUAL(streamed->asJson(0, false), parsed->asJson(0, false));
+    BOOST_CHECK(streamed->atKey("key4999").atKey("v").getSubObjects().at(0)->asInt() == 4999);
+
+    std::istringstream brokenStream(data.substr(0, data.size() - 40) + ",}");
+    BOOST_CHECK_THROW(ConvertJsonStreamToData(brokenStream), DataObjectException);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
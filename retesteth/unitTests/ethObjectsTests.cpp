@@ -18,9 +18,15 @@
  * Unit tests for ethObjects functions.
  */
 
+#include "TempDirFixture.h"
 #include <libdataobj/ConvertFile.h>
+#include <libdevcore/CommonIO.h>
 #include <retesteth/helpers/TestHelper.h>
 #include <retesteth/helpers/TestOutputHelper.h>
+#include <retesteth/configs/ClientConfig.h>
+#include <retesteth/session/ToolBackend/ToolChainManager.h>
+#include <retesteth/session/ToolBackend/ToolStateReader.h>
+#include <retesteth/testStructures/types/EOFTests/EOFContainer.h>
 #include <retesteth/testSuites/Common.h>
 
 using namespace std;
@@ -28,6 +34,7 @@ using namespace dev;
 using namespace test;
 using namespace test::debug;
 using namespace test::teststruct;
+using namespace test::unittests;
 
 BOOST_FIXTURE_TEST_SUITE(EthObjectsSuite, TestOutputHelperFixture)
 
@@ -557,6 +564,129 @@ BOOST_AUTO_TEST_CASE(compareStates_storageCombinations)
     ExpectVsPost("0x00", "0x01", "0x00", "0x01", CompareResult::IncorrectStorage, "0x03");
 }
 
+BOOST_AUTO_TEST_CASE(readToolState_sharesUnchangedAccounts)
+{
+    string const addrA = "0xa94f5374fce5edbc8e2a8697c15331677e6ebf0b";
+    string const addrB = "0x095e7baea6a6c7c4c2dfeb977efac326af552d87";
+    spDataObject preData;
+    for (auto const& addr : {addrA, addrB})
+    {
+        (*preData)[addr]["balance"] = "0x0100";
+        (*preData)[addr]["code"] = "0x";
+        (*preData)[addr]["nonce"] = "0x00";
+        (*preData)[addr]["storage"]["0x01"] = "0x01";
+    }
+    spState preState(new State(dataobject::move(preData)));
+
+    // The tool omits empty fields and keeps leading zeros in storage
+    string const toolAlloc = R"({
+        "0xa94f5374fce5edbc8e2a8697c15331677e6ebf0b" : { "balance" : "0x0100", "storage" : { "0x01" : "0x0001" } },
+        "0x095e7baea6a6c7c4c2dfeb977efac326af552d87" : {
+            "balance" : "0x0100", "nonce" : "0x01", "secretKey" : "0x45", "storage" : { "0x0001" : "0x01", "0x02" : "0x00" }
+        }
+    })";
+    spState postState = toolimpl::readToolState(toolAlloc, preState);
+
+    BOOST_CHECK(&postState->accounts().at(FH20(addrA)).getCContent() == &preState->accounts().at(FH20(addrA)).getCContent());
+    BOOST_CHECK(&postState->accounts().at(FH20(addrB)).getCContent() != &preState->accounts().at(FH20(addrB)).getCContent());
+    auto const& accB = postState->getAccount(FH20(addrB));
+    BOOST_CHECK(accB.nonce() == 1);
+    BOOST_CHECK(accB.code().asString() == "0x");
+    BOOST_CHECK(accB.storage().atKey(VALUE(1)) == 1);
+    BOOST_CHECK(accB.storage().atKey(VALUE(2)) == 0);
+    BOOST_CHECK(postState->asDataObject()->getSubObjects().size() == 2);
+    BOOST_CHECK(postState->asDataObject()->atKey(addrB).atKey("storage").atKey("0x02").asString() == "0x00");
+}
+
+BOOST_AUTO_TEST_CASE(readToolState_malformed)
+{
+    spDataObject preData(new DataObject(DataType::Object));
+    spState preState(new State(dataobject::move(preData)));
+    BOOST_CHECK_THROW(toolimpl::readToolState(R"({ "0xa94f5374fce5edbc8e2a8697c15331677e6ebf0b" : { "balance" })", preState),
+        test::UpwardsException);
+
+    // Values are checked like VALUE, but leading zeros are allowed
+    string const tooBig = "0x01" + string(64, '0');
+    BOOST_CHECK_THROW(toolimpl::readToolState(
+                          R"({ "0xa94f5374fce5edbc8e2a8697c15331677e6ebf0b" : { "balance" : ")" + tooBig + R"(" } })", preState),
+        test::UpwardsException);
+    BOOST_CHECK_THROW(toolimpl::readToolState(
+                          R"({ "0xa94f5374fce5edbc8e2a8697c15331677e6ebf0b" : { "nonce" : "0x1g" } })", preState),
+        test::UpwardsException);
+    BOOST_CHECK_THROW(toolimpl::readToolState(
+                          R"({ "0xa94f5374fce5edbc8e2a8697c15331677e6ebf0b" : { "storage" : { "0x01" : "12" } } })", preState),
+        test::UpwardsException);
+    string const padded = "0x" + string(62, '0') + "01";
+    BOOST_CHECK_NO_THROW(toolimpl::readToolState(
+        R"({ "0xa94f5374fce5edbc8e2a8697c15331677e6ebf0b" : { "storage" : { ")" + padded + R"(" : ")" + padded + R"(" } } })",
+        preState));
+}
+
+BOOST_FIXTURE_TEST_CASE(test_rawTransactions_oneToolCall, TempDirFixture)
+{
+    boost::filesystem::path const& dir = tempDir();
+    boost::filesystem::path const tool = dir / "t9n.sh";
+    string const script = "#!/bin/sh\necho call >> " + (dir / "calls").string() +
+                          "\necho '[{\"error\":\"a\",\"intrinsicGas\":\"0x10\"},{\"error\":\"b\"}]'\n";
+    writeFileExec(tool, bytesConstRef(script));
+
+    // Typed transactions go in one list, broken rlp is checked alone
+    std::vector<BYTES> rlps;
+    rlps.emplace_back("0x01aa");
+    rlps.emplace_back("0xf8");
+    rlps.emplace_back("0x02bb");
+    auto const res = toolimpl::ToolChainManager::test_rawTransactions(rlps, FORK("London"), tool, dir);
+    BOOST_REQUIRE_EQUAL(res.size(), 3);
+    BOOST_CHECK_EQUAL(res.at(0).error(), "a");
+    BOOST_CHECK(res.at(0).intrinsicGas() == 16);
+    BOOST_CHECK_EQUAL(res.at(1).error(), "a");
+    BOOST_CHECK_EQUAL(res.at(2).error(), "b");
+    BOOST_CHECK_EQUAL(contentsString(dir / "calls"), "call\ncall\n");
+}
+
+BOOST_FIXTURE_TEST_CASE(test_rawEOFCodes_oneToolCall, TempDirFixture)
+{
+    boost::filesystem::path const& dir = tempDir();
+    boost::filesystem::path const tool = dir / "evm.sh";
+    string const script = "#!/bin/sh\nif [ \"$4\" = --hex ]; then echo \"OK $5\"; exit 0; fi\necho call >> " + (dir / "calls").string() +
+                          "\nwhile read code; do case $code in ef*) echo OK 00;; *) echo 'err: invalid_prefix';; esac; done\n";
+    writeFileExec(tool, bytesConstRef(script));
+
+    std::vector<BYTES> codes;
+    codes.emplace_back("0xef000101000402000100010300000000000000fe");
+    codes.emplace_back("0x6000");
+    auto const res = toolimpl::ToolChainManager::test_rawEOFCodes(codes, FORK("Cancun"), tool, dir);
+    BOOST_REQUIRE_EQUAL(res.size(), 2);
+    BOOST_CHECK_EQUAL(res.at(0), "ok.");
+    BOOST_CHECK_EQUAL(res.at(1), "err: invalid_prefix");
+    BOOST_CHECK_EQUAL(contentsString(dir / "calls"), "call\n");
+
+    // A single code gives the same result as the list
+    BOOST_CHECK_EQUAL(toolimpl::ToolChainManager::test_rawEOFCode(codes.at(0), FORK("Cancun"), tool, dir), "ok.");
+}
+
+BOOST_AUTO_TEST_CASE(validateEOFHeader_sections)
+{
+    auto check = [](string const& _code, string const& _exception) {
+        BOOST_CHECK_EQUAL(validateEOFHeader(fromHex(_code)), _exception);
+    };
+    check("ef000101000402000100010300000000000000fe", "");
+    check("ef000101000402000100010300020000000000fe0102", "");
+    check("6000", "EOF_InvalidPrefix");
+    check("ef000201000402000100010300000000000000fe", "EOF_UnknownVersion");
+    check("ef0001020001000103000000fe", "EOF_TypeSectionMissing");
+    check("ef000101000403000000", "EOF_CodeSectionMissing");
+    check("ef000101000402000100010000000000fe", "EOF_DataSectionMissing");
+    check("ef000101000402000100010300000100000000fe", "EOF_HeaderTerminatorMissing");
+    check("ef0001010000020001000103000000fe", "EOF_ZeroSectionSize");
+    check("ef000101000402000003000000", "EOF_ZeroSectionSize");
+    check("ef0001010004020001", "EOF_IncompleteSectionSize");
+    check("ef000101000402", "EOF_IncompleteSectionNumber");
+    check("ef00010100040200010001030000", "EOF_SectionHeadersNotTerminated");
+    check("ef000101000402000100010300000000000000", "EOF_InvalidSectionBodiesSize");
+    check("ef00010100080200010001030000000000000000000000fe", "EOF_InvalidTypeSectionSize");
+}
+
 BOOST_AUTO_TEST_CASE(clientconfigTest)
 {
     string data = R"(
@@ -594,4 +724,20 @@ BOOST_AUTO_TEST_CASE(clientconfigTest)
     BOOST_CHECK(cfg.socketAdresses().at(1).asString() == "127.0.0.1:8546");
 }
 
+BOOST_AUTO_TEST_CASE(clientConfig_compileFieldReplace)
+{
+    // Rules are applied in order, same as renaming the keys rule by rule
+    std::map<string, string> const rules = {{"a", "b"}, {"b", "c"}, {"x", "y"}};
+    KeyReplaceMap const toClient = ClientConfig::compileFieldReplace(rules, FieldReplaceDir::RetestethToClient);
+    BOOST_CHECK_EQUAL(toClient.at("a"), "c");
+    BOOST_CHECK_EQUAL(toClient.at("b"), "c");
+    BOOST_CHECK_EQUAL(toClient.at("x"), "y");
+    BOOST_CHECK(!toClient.count("c"));
+
+    KeyReplaceMap const toRetesteth = ClientConfig::compileFieldReplace(rules, FieldReplaceDir::ClientToRetesteth);
+    BOOST_CHECK_EQUAL(toRetesteth.at("b"), "a");
+    BOOST_CHECK_EQUAL(toRetesteth.at("c"), "b");
+    BOOST_CHECK_EQUAL(toRetesteth.at("y"), "x");
+}
+
 BOOST_AUTO_TEST_SUITE_END()
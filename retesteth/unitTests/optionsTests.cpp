@@ -280,4 +280,27 @@ BOOST_AUTO_TEST_CASE(options_singlenetMultiple)
     }
 }
 
+BOOST_AUTO_TEST_CASE(options_shard)
+{
+    const char* argv[] = {"./retesteth", "--", "--shard", "2/5"};
+    TestOptions opt(std::size(argv), argv);
+    BOOST_CHECK(opt.get().shard.initialized() == true);
+    BOOST_CHECK(opt.get().shard.index == 2);
+    BOOST_CHECK(opt.get().shard.count == 5);
+    BOOST_CHECK(opt.get().shard.str() == "2/5");
+    for (auto const& wrong : {"0/5", "6/5", "2", "a/5"})
+    {
+        try
+        {
+            const char* argv[] = {"./retesteth", "--", "--shard", wrong};
+            TestOptions opt(std::size(argv), argv);
+            BOOST_ERROR("Expected Exception!");
+        }
+        catch (std::exception const& _ex)
+        {
+            BOOST_CHECK(string(_ex.what()).find("`--shard`") != string::npos);
+        }
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
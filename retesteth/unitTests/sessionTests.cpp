@@ -0,0 +1,221 @@
+#include <libdataobj/ConvertFile.h>
+#include <retesteth/Options.h>
+#include <retesteth/helpers/TestOutputHelper.h>
+#include <retesteth/session/RPCCache.h>
+#include <retesteth/session/Session.h>
+#include <retesteth/session/ThreadManager.h>
+#include <atomic>
+#include <future>
+#include <thread>
+
+using namespace std;
+using namespace dev;
+using namespace test;
+using namespace test::session;
+using namespace dataobject;
+
+namespace
+{
+string const c_blockResponse = R"({
+    "difficulty" : "0x020000",
+    "extraData" : "0x00",
+    "gasLimit" : "0x7fffffffffffffff",
+    "gasUsed" : "0x00",
+    "hash" : "0x8fb4bd6fbe73d2f5ea4a3c1ddf4dd5a9e8c6e5b0b2e5d4c4a3b2a1f0e9d8c7b6",
+    "logsBloom" : "0x00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "miner" : "0x2adc25665018aa1fe0e6bc666dac8fc2697ff9ba",
+    "mixHash" : "0x0000000000000000000000000000000000000000000000000000000000000000",
+    "nonce" : "0x0000000000000000",
+    "number" : "0x03",
+    "parentHash" : "0x1e1f0b4ad2dfa6e69bf8f1a4bd6d68f0f1d7ad27c8ba6fc2ab3ef6e2e7a2c9d1",
+    "receiptsRoot" : "0x56e81f171bcc55a6ff8345e692c0f86e5b48e01b996cadc001622fb5e363b421",
+    "sha3Uncles" : "0x1dcc4de8dec75d7aab85b567b6ccd41ad312451b948a7413f0a142fd40d49347",
+    "size" : "0x01f8",
+    "stateRoot" : "0xf3d3787e33cb7913a304f188002f59e7b7440f29a9cd7d5d9fd8e2a1d2f2c8a4",
+    "timestamp" : "0x03e8",
+    "totalDifficulty" : "0x080000",
+    "transactions" : [],
+    "transactionsRoot" : "0x56e81f171bcc55a6ff8345e692c0f86e5b48e01b996cadc001622fb5e363b421",
+    "uncles" : []
+})";
+
+spEthGetBlockBy makeBlock()
+{
+    spDataObject response = ConvertJsoncppStringToData(c_blockResponse);
+    return spEthGetBlockBy(new EthGetBlockBy(response));
+}
+
+// Sessions of the transition tool config are created without starting a client
+bool setToolConfig()
+{
+    auto& dopt = Options::getDynamicOptions();
+    for (auto const& config : dopt.getClientConfigs())
+    {
+        if (config.cfgFile().socketType() == ClientConfgSocketType::TransitionTool)
+        {
+            dopt.setCurrentConfig(config);
+            return true;
+        }
+    }
+    return false;
+}
+
+// A test thread that has finished with its session, the thread id is kept until destruction
+class FinishedTestThread
+{
+public:
+    FinishedTestThread()
+      : m_thread([this]() {
+            RPCSession::instance(std::this_thread::get_id());
+            RPCSession::sessionEnd(std::this_thread::get_id(), RPCSession::SessionStatus::Available);
+            m_opened.set_value();
+            m_release.get_future().wait();
+        })
+    {
+        m_opened.get_future().wait();
+    }
+    ~FinishedTestThread()
+    {
+        m_release.set_value();
+        m_thread.join();
+    }
+
+private:
+    std::promise<void> m_opened;
+    std::promise<void> m_release;
+    std::thread m_thread;
+};
+}  // namespace
+
+BOOST_FIXTURE_TEST_SUITE(SessionSuite, TestOutputHelperFixture)
+
+BOOST_AUTO_TEST_CASE(lruMap_evictsLeastRecentlyUsed)
+{
+    LRUMap<int> map(2);
+    map.put("a", 1);
+    map.put("b", 2);
+    BOOST_REQUIRE(map.get("a") != nullptr);  // b is now the least recently used
+    map.put("c", 3);
+    BOOST_CHECK_EQUAL(map.size(), 2);
+    BOOST_CHECK(map.get("b") == nullptr);
+    BOOST_CHECK_EQUAL(*map.get("a"), 1);
+    BOOST_CHECK_EQUAL(*map.get("c"), 3);
+
+    // Updating a value does not grow the map
+    map.put("a", 4);
+    BOOST_CHECK_EQUAL(map.size(), 2);
+    BOOST_CHECK_EQUAL(*map.get("a"), 4);
+
+    map.eraseIf([](int _value) { return _value > 3; });
+    BOOST_CHECK(map.get("a") == nullptr);
+    BOOST_CHECK_EQUAL(map.size(), 1);
+    map.clear();
+    BOOST_CHECK(map.get("c") == nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(rpcCache_invalidation)
+{
+    RPCCache cache;
+    FH20 const address("0x095e7baea6a6c7c4c2dfeb977efac326af552d87");
+    auto const balance = [&cache, &address](int _number) {
+        return cache.getAccountField(RPCCache::AccountField::BALANCE, address, VALUE(_number));
+    };
+    cache.putAccountField(RPCCache::AccountField::BALANCE, address, VALUE(1), sDataObject("0x01"));
+    cache.putAccountField(RPCCache::AccountField::BALANCE, address, VALUE(3), sDataObject("0x03"));
+    cache.putBlock(makeBlock(), false, true);
+    FH32 const hash(ConvertJsoncppStringToData(c_blockResponse)->atKey("hash"));
+    BOOST_CHECK(!balance(1).isEmpty());
+    BOOST_CHECK(!cache.getBlockByNumber(VALUE(3), false).isEmpty());
+    BOOST_CHECK(cache.getBlockByNumber(VALUE(3), true).isEmpty());
+
+    // Rewind drops the data above the block
+    cache.onRewindToBlock(VALUE(2));
+    BOOST_CHECK(!balance(1).isEmpty());
+    BOOST_CHECK(balance(3).isEmpty());
+    BOOST_CHECK(cache.getBlockByNumber(VALUE(3), false).isEmpty());
+    BOOST_CHECK(cache.getBlockByHash(hash, false).isEmpty());
+
+    // Import could reorg the chain, blocks by hash stay valid
+    cache.putBlock(makeBlock(), false, true);
+    cache.onImportRawBlock();
+    BOOST_CHECK(balance(1).isEmpty());
+    BOOST_CHECK(cache.getBlockByNumber(VALUE(3), false).isEmpty());
+    BOOST_CHECK(!cache.getBlockByHash(hash, false).isEmpty());
+
+    cache.onSetChainParams();
+    BOOST_CHECK(cache.getBlockByHash(hash, false).isEmpty());
+}
+
+BOOST_AUTO_TEST_CASE(rpcCache_sharesBlocks)
+{
+    RPCCache cache;
+    spEthGetBlockBy const block = makeBlock();
+    cache.putBlock(block, false, true);
+    BOOST_CHECK(&cache.getBlockByNumber(VALUE(3), false).getCContent() == &block.getCContent());
+    BOOST_CHECK(&cache.getBlockByHash(block->header()->hash(), false).getCContent() == &block.getCContent());
+
+    FH20 const address("0x095e7baea6a6c7c4c2dfeb977efac326af552d87");
+    cache.putAccountField(RPCCache::AccountField::CODE, address, VALUE(1), sDataObject("0x60"));
+    spDataObject code = cache.getAccountField(RPCCache::AccountField::CODE, address, VALUE(1));
+    BOOST_REQUIRE(!code.isEmpty());
+    code.getContent() = string("0x00");
+    BOOST_CHECK_EQUAL(cache.getAccountField(RPCCache::AccountField::CODE, address, VALUE(1))->asString(), "0x60");
+}
+
+BOOST_AUTO_TEST_CASE(threadManager_subTasksMoreThanThreads)
+{
+    const char* argv[] = {"./retesteth", "--", "-j", "2"};
+    TestOptions opt(std::size(argv), argv);
+    opt.overrideMainOptions();
+    if (!setToolConfig())
+        return;
+
+    SessionInterface& own = RPCSession::instance(std::this_thread::get_id());
+    FinishedTestThread finished;
+
+    size_t const tasks = 10;
+    std::vector<std::atomic<size_t>> runs(tasks);
+    std::atomic<size_t> inits = 0;
+    auto init = [&inits](SessionInterface&) { inits++; };
+    auto task = [&runs](SessionInterface&, size_t _i) {
+        runs.at(_i)++;
+        if (_i == tasks - 1)
+            TestOutputHelper::get().markError("sub task error");
+    };
+    ThreadManager::runSubTasks(tasks, own, init, task);
+    for (auto const& el : runs)
+        BOOST_CHECK_EQUAL(el, 1);
+    BOOST_CHECK_EQUAL(inits, 1);
+
+    // The error of a sub task belongs to the test that started it
+    std::vector<std::string> const errors = TestOutputHelper::get().getErrors();
+    BOOST_REQUIRE_EQUAL(errors.size(), 1);
+    BOOST_CHECK(errors.at(0).find("sub task error") != std::string::npos);
+    TestOutputHelper::get().unmarkLastError();
+    RPCSession::clear();
+}
+
+BOOST_AUTO_TEST_CASE(rpcSession_waitsForLentSession)
+{
+    const char* argv[] = {"./retesteth", "--", "-j", "2"};
+    TestOptions opt(std::size(argv), argv);
+    opt.overrideMainOptions();
+    if (!setToolConfig())
+        return;
+
+    RPCSession::instance(std::this_thread::get_id());
+    FinishedTestThread finished;
+
+    // The pool is full and its free session is lent, a new test thread must wait for it
+    SessionInterface* lent = RPCSession::borrowIdleSession();
+    BOOST_REQUIRE(lent != nullptr);
+    SessionInterface* taken = nullptr;
+    std::thread th([&taken]() { taken = &RPCSession::instance(std::this_thread::get_id()); });
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    RPCSession::returnSession(lent);
+    th.join();
+    BOOST_CHECK(taken == lent);
+    RPCSession::clear();
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -2,6 +2,7 @@
 #include <retesteth/Options.h>
 #include <retesteth/helpers/TestHelper.h>
 #include <retesteth/helpers/TestOutputHelper.h>
+#include <retesteth/session/RPCRequest.h>
 #include <retesteth/testStructures/types/Ethereum/Transactions/TransactionReader.h>
 
 using namespace std;
@@ -607,4 +608,24 @@ BOOST_AUTO_TEST_CASE(transactionLegacy_bigint_serialization)
     ETH_ERROR_REQUIRE_MESSAGE(spTr->hash() == spTr2->hash(), "Transaction deserialized hash is different (before != after) " + spTr->hash().asString() + " != " + spTr2->hash().asString())
 }
 
+BOOST_AUTO_TEST_CASE(rpcRequest_format)
+{
+    test::session::RPCRequest request;
+    string const& req = request.begin("test_method")
+                            .str("0x01")
+                            .bytes(BYTES(DataObject("0xAABB")))
+                            .num(1234567)
+                            .boolean(true)
+                            .json("{\"a\":1}")
+                            .end(42);
+    string const expected =
+        R"({"jsonrpc":"2.0","method":"test_method","params":["0x01", "0xaabb", 1234567, true, {"a":1}],"id":42})";
+    ETH_ERROR_REQUIRE_MESSAGE(req == expected, "RPCRequest different to expected: " + req);
+
+    // The buffer is reused for the next request
+    string const& req2 = request.begin("eth_blockNumber").end(43);
+    string const expected2 = R"({"jsonrpc":"2.0","method":"eth_blockNumber","params":[],"id":43})";
+    ETH_ERROR_REQUIRE_MESSAGE(req2 == expected2, "RPCRequest different to expected: " + req2);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
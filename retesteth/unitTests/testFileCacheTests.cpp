@@ -0,0 +1,115 @@
+#include "TempDirFixture.h"
+#include <libdevcore/CommonIO.h>
+#include <libdataobj/ConvertBinary.h>
+#include <libdataobj/ConvertFile.h>
+#include <retesteth/testSuiteRunner/FillerHashIndex.h>
+#include <retesteth/testSuiteRunner/TestFileCache.h>
+#include <retesteth/testSuiteRunner/TestSuiteHelperFunctions.h>
+#include <atomic>
+#include <thread>
+
+using namespace std;
+using namespace dev;
+using namespace dataobject;
+using namespace test::testsuite;
+using namespace test::unittests;
+namespace fs = boost::filesystem;
+
+BOOST_FIXTURE_TEST_SUITE(TestFileCacheSuite, TempDirFixture)
+
+BOOST_AUTO_TEST_CASE(testFileCache_binaryEntry)
+{
+    fs::path const file = tempDir() / "test.json";
+    writeFile(file, asBytes(string(R"({ "test" : { "b" : [1, true, null, "0x01"], "a" : {} } })")));
+    TestFileCache cache(tempDir() / "cache", 1024 * 1024);
+    CJOptions const opt{.autosort = true};
+    spDataObject const parsed = cache.readJson(file, opt);
+    string const entryKey = TestFileCache::key(contentsString(file), opt);
+    spDataObject const cached = cache.find(entryKey);
+    BOOST_REQUIRE(!cached.isEmpty());
+    BOOST_CHECK_EQUAL(cached->asJson(0, false), parsed->asJson(0, false));
+    BOOST_CHECK(cached->atKey("test").isAutosort());
+
+    // Parse options are part of the key
+    BOOST_CHECK(cache.find(TestFileCache::key(contentsString(file), CJOptions())).isEmpty());
+}
+
+BOOST_AUTO_TEST_CASE(testFileCache_concurrentInsert)
+{
+    TestFileCache cache(tempDir() / "cache", 1024 * 1024);
+    spDataObject const data = ConvertJsoncppStringToData(R"({ "test" : { "a" : [1, 2, 3] } })");
+    string const entryKey = TestFileCache::key("concurrent", CJOptions());
+
+    // Threads that write the same entry use their own temp files, a reader never sees a partial entry
+    std::atomic<size_t> broken = 0;
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < 4; i++)
+        threads.emplace_back([&cache, &data, &entryKey, &broken]() {
+            for (size_t j = 0; j < 20; j++)
+            {
+                cache.insert(entryKey, data.getCContent());
+                spDataObject const cached = cache.find(entryKey);
+                if (cached.isEmpty() || cached->asJson(0, false) != data->asJson(0, false))
+                    broken++;
+            }
+        });
+    for (auto& th : threads)
+        th.join();
+    BOOST_CHECK_EQUAL(broken, 0);
+
+    size_t files = 0;
+    for (fs::recursive_directory_iterator it(tempDir() / "cache"), end; it != end; ++it)
+        files += fs::is_regular_file(it->path());
+    BOOST_CHECK_EQUAL(files, 1);
+}
+
+BOOST_AUTO_TEST_CASE(testFileCache_eviction)
+{
+    fs::path const dir = tempDir() / "cache";
+    spDataObject const data = ConvertJsoncppStringToData(R"({ "test" : { "a" : "0x0102030405060708" } })");
+    size_t const entrySize = ConvertDataToBinary(data.getCContent()).size();
+    TestFileCache cache(dir, entrySize * 3);
+
+    // Folder is bound by the size limit, the oldest entries are removed
+    for (size_t i = 0; i < 6; i++)
+        cache.insert(TestFileCache::key(to_string(i), CJOptions()), data.getCContent());
+    cache.evict();
+    uintmax_t total = 0;
+    for (fs::recursive_directory_iterator it(dir), end; it != end; ++it)
+        if (fs::is_regular_file(it->path()))
+            total += fs::file_size(it->path());
+    BOOST_CHECK(total <= entrySize * 3);
+    BOOST_CHECK(!cache.find(TestFileCache::key("5", CJOptions())).isEmpty());
+    BOOST_CHECK(cache.find(TestFileCache::key("0", CJOptions())).isEmpty());
+}
+
+BOOST_AUTO_TEST_CASE(fillerHashIndex_reuseAndUpdate)
+{
+    fs::path const filler = tempDir() / "testFiller.json";
+    fs::path const filled = tempDir() / "test.json";
+    writeFile(filler, asBytes(string(R"({ "test" : { "env" : "1" } })")));
+    writeFile(filled, asBytes(string(R"({ "test" : { "_info" : { "sourceHash" : "0x12", "comment" : "" }, "post" : {} } })")));
+
+    h256 fillerHash;
+    {
+        FillerHashIndex index(tempDir());
+        fillerHash = index.filler(filler).hash;
+        BOOST_CHECK(fillerHash == readFillerTestFile(filler).hash);
+        spDataObject const tests = index.filled(filled);
+        BOOST_CHECK_EQUAL(tests->atKey("test").atKey("_info").atKey("sourceHash").asString(), "0x12");
+        BOOST_CHECK(!tests->atKey("test").atKey("_info").count("comment"));
+    }
+    BOOST_REQUIRE(fs::exists(tempDir() / ".fillerHashIndex"));
+
+    // Unchanged files are taken from the saved index, changed files are read again
+    writeFile(filler, asBytes(string(R"({ "test" : { "env" : "22" } })")));
+    {
+        FillerHashIndex index(tempDir());
+        BOOST_CHECK_EQUAL(index.filled(filled)->atKey("test").atKey("_info").atKey("sourceHash").asString(), "0x12");
+        h256 const newHash = index.filler(filler).hash;
+        BOOST_CHECK(newHash != fillerHash);
+        BOOST_CHECK(newHash == readFillerTestFile(filler).hash);
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -21,12 +21,16 @@
 #include <libdevcore/CommonIO.h>
 #include <retesteth/EthChecks.h>
 #include <retesteth/Options.h>
+#include <boost/filesystem.hpp>
+#include <retesteth/helpers/LogSink.h>
+#include <retesteth/helpers/Process.h>
 #include <retesteth/helpers/TestHelper.h>
 #include <retesteth/helpers/TestOutputHelper.h>
 
 using namespace std;
 using namespace dev;
 using namespace test;
+namespace fs = boost::filesystem;
 
 namespace
 {
@@ -277,4 +281,59 @@ BOOST_AUTO_TEST_CASE(getTestSuggestions2)
     BOOST_CHECK(test::inArray(list, string("BCGeneralStateTests/stExample")));
 }
 
+BOOST_AUTO_TEST_CASE(mpscRing_concurrentPush)
+{
+    size_t const producers = 4;
+    size_t const perProducer = 20000;
+    MPSCRing<size_t> ring(64);
+    std::vector<std::thread> threads;
+    for (size_t p = 0; p < producers; p++)
+        threads.emplace_back([&ring, p, perProducer]() {
+            for (size_t i = 0; i < perProducer; i++)
+                while (!ring.tryPush(p * perProducer + i))
+                    std::this_thread::yield();
+        });
+
+    // Values of every producer must arrive once and in order
+    std::vector<size_t> next(producers, 0);
+    size_t received = 0;
+    size_t value;
+    while (received < producers * perProducer)
+    {
+        if (!ring.tryPop(value))
+            continue;
+        size_t const p = value / perProducer;
+        BOOST_REQUIRE(p < producers);
+        BOOST_REQUIRE_EQUAL(value % perProducer, next[p]);
+        next[p]++;
+        received++;
+    }
+    for (auto& th : threads)
+        th.join();
+    BOOST_CHECK(!ring.tryPop(value));
+}
+
+BOOST_AUTO_TEST_CASE(runProcess_capture)
+{
+    ProcessResult const res = runProcess({"sh", "-c", "echo out; echo err 1>&2; exit 3"}, ProcessStderr::Capture);
+    BOOST_CHECK_EQUAL(res.out, "out\n");
+    BOOST_CHECK_EQUAL(res.err, "err\n");
+    BOOST_CHECK(WIFEXITED(res.exitCode) && WEXITSTATUS(res.exitCode) == 3);
+    BOOST_CHECK(!findExecutable("sh").empty());
+    BOOST_CHECK(findExecutable("retesteth_not_existing_command").empty());
+    BOOST_CHECK(checkCmdExist("sh -c true"));
+    BOOST_CHECK(checkCmdExist(fs::temp_directory_path().string()));
+    BOOST_CHECK(!checkCmdExist("retesteth_not_existing_command --version"));
+}
+
+BOOST_AUTO_TEST_CASE(runProcess_stdin)
+{
+    fs::path const input = fs::temp_directory_path() / fs::unique_path("retesteth-stdin-%%%%-%%%%");
+    dev::writeFile(input, dev::asBytes(string("line1\nline2\n")));
+    ProcessResult const res = runProcess({"cat"}, ProcessStderr::Capture, input);
+    fs::remove(input);
+    BOOST_CHECK_EQUAL(res.out, "line1\nline2\n");
+    BOOST_CHECK_EQUAL(res.exitCode, 0);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
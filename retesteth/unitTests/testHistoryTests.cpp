@@ -0,0 +1,53 @@
+#include "TempDirFixture.h"
+#include <libdevcore/CommonIO.h>
+#include <retesteth/helpers/TestHistory.h>
+
+using namespace std;
+using namespace dev;
+using namespace test;
+using namespace test::unittests;
+namespace fs = boost::filesystem;
+
+BOOST_FIXTURE_TEST_SUITE(TestHistorySuite, TempDirFixture)
+
+BOOST_AUTO_TEST_CASE(testHistory_longestFirst)
+{
+    fs::path const file = tempDir() / "testhistory.json";
+    {
+        TestHistory history(file);
+        history.update({{"f/a", {1, false}}, {"f/b", {4, true}}, {"f/c", {2, false}}});
+        history.save();
+    }
+    TestHistory history(file);
+    vector<string> const tests = {"f/a", "f/new", "f/b", "f/slow", "f/c"};
+    vector<size_t> const expected = {3, 2, 1, 4, 0};
+    BOOST_CHECK(history.order(tests, {false, false, false, true, false}) == expected);
+
+    // New times are averaged with the history
+    history.update({{"f/a", {9, false}}});
+    BOOST_CHECK(history.order({"f/a", "f/b"}, {false, false}) == vector<size_t>({0, 1}));
+}
+
+BOOST_AUTO_TEST_CASE(testHistory_mergeParallelRuns)
+{
+    fs::path const file = tempDir() / "testhistory.json";
+    string const saved = "{\"f/a\" : 2000, \"f/b\" : 1000}";
+    writeFile(file, bytesConstRef(saved));
+
+    // Both runs start from the same file and save one after another
+    TestHistory first(file);
+    TestHistory second(file);
+    first.update({{"f/a", {4, false}}});
+    second.update({{"f/c", {3, false}}});
+    first.save();
+    second.save();
+
+    map<string, double> const times = TestHistory::readTimes(file);
+    BOOST_CHECK(times == (map<string, double>{{"f/a", 3}, {"f/b", 1}, {"f/c", 3}}));
+
+    // A run without new times keeps the file as it is
+    TestHistory(file).save();
+    BOOST_CHECK(TestHistory::readTimes(file) == times);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
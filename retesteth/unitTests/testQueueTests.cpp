@@ -0,0 +1,94 @@
+#include <retesteth/Options.h>
+#include <retesteth/helpers/TestOutputHelper.h>
+#include <retesteth/session/Session.h>
+#include <retesteth/testSuiteRunner/TestQueue.h>
+#include <atomic>
+#include <thread>
+
+using namespace std;
+using namespace test;
+using namespace test::session;
+using namespace test::testsuite;
+
+namespace
+{
+// The queue threads need a client config, the transition tool one does not start a client
+bool setToolConfig()
+{
+    auto& dopt = Options::getDynamicOptions();
+    for (auto const& config : dopt.getClientConfigs())
+    {
+        if (config.cfgFile().socketType() == ClientConfgSocketType::TransitionTool)
+        {
+            dopt.setCurrentConfig(config);
+            return true;
+        }
+    }
+    return false;
+}
+}  // namespace
+
+BOOST_FIXTURE_TEST_SUITE(TestQueueSuite, TestOutputHelperFixture)
+
+BOOST_AUTO_TEST_CASE(testInfo_queuedTestCase)
+{
+    BOOST_CHECK_EQUAL(TestInfo::caseName(), "testInfo_queuedTestCase");
+    TestInfo::CaseNames const queued = {"stExample", "GeneralStateTests", "EthereumTests/GeneralStateTests/stExample"};
+    TestOutputHelper::get().setQueuedTestCase(queued);
+    BOOST_CHECK_EQUAL(TestInfo::caseName(), "stExample");
+    BOOST_CHECK_EQUAL(TestInfo::caseFullName(), queued.fullName);
+    BOOST_CHECK(TestInfo("step").errorDebug().find("(GeneralStateTests/stExample/") != string::npos);
+    TestOutputHelper::get().setQueuedTestCase(TestInfo::CaseNames());
+    BOOST_CHECK_EQUAL(TestInfo::caseName(), "testInfo_queuedTestCase");
+}
+
+BOOST_AUTO_TEST_CASE(testQueue_runFolders)
+{
+    const char* argv[] = {"./retesteth", "--", "-j", "2"};
+    TestOptions opt(std::size(argv), argv);
+    opt.overrideMainOptions();
+    if (!setToolConfig())
+    {
+        BOOST_TEST_MESSAGE("testQueue_runFolders skipped: no t8ntool client config found");
+        return;
+    }
+
+    size_t const tasks = 6;
+    std::atomic<size_t> runs = 0;
+    std::atomic<size_t> wrongCase = 0;
+    std::atomic<size_t> finished = 0;
+    vector<TestQueue::Task> queued(tasks);
+    for (size_t i = 0; i < tasks; i++)
+    {
+        queued.at(i).key = "GeneralStateTests/stQueue/test" + to_string(i);
+        queued.at(i).slow = i == 0;
+        queued.at(i).job = [&runs, &wrongCase]() {
+            // A test thread is joined when its session has finished
+            RPCSession::instance(std::this_thread::get_id());
+            runs++;
+            if (TestInfo::caseName() != "testQueue_runFolders")
+                wrongCase++;
+            RPCSession::sessionEnd(std::this_thread::get_id(), RPCSession::SessionStatus::HasFinished);
+        };
+    }
+    auto const onFinished = [&finished]() { finished++; };
+
+    // An empty folder is finished right away
+    TestQueue::addFolder("stEmpty", {}, onFinished);
+    BOOST_CHECK_EQUAL(finished, 1);
+
+    TestQueue::addFolder("stQueue", std::move(queued), onFinished);
+    BOOST_CHECK_EQUAL(finished, 1);
+    BOOST_CHECK_EQUAL(TestQueue::run(), 0);
+    BOOST_CHECK_EQUAL(runs, tasks);
+    BOOST_CHECK_EQUAL(wrongCase, 0);
+    BOOST_CHECK_EQUAL(finished, 2);
+
+    // The queue is empty after a run
+    BOOST_CHECK_EQUAL(TestQueue::run(), 0);
+    BOOST_CHECK_EQUAL(finished, 2);
+    TestOutputHelper::get().setQueuedTestCase(TestInfo::CaseNames());
+    RPCSession::clear();
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,96 @@
+#include "TempDirFixture.h"
+#include <libdevcore/CommonIO.h>
+#include <retesteth/helpers/TestHistory.h>
+#include <retesteth/helpers/TestReport.h>
+#include <retesteth/testSuiteRunner/TestShard.h>
+
+using namespace std;
+using namespace dev;
+using namespace test;
+using namespace test::testsuite;
+using namespace test::unittests;
+using namespace dataobject;
+namespace fs = boost::filesystem;
+
+BOOST_FIXTURE_TEST_SUITE(TestShardSuite, TempDirFixture)
+
+BOOST_AUTO_TEST_CASE(testShard_selectEveryTestOnce)
+{
+    vector<string> keys;
+    for (size_t i = 0; i < 50; i++)
+        keys.emplace_back("GeneralStateTests/stExample/test" + to_string(i));
+    map<string, double> durations;
+    for (size_t i = 0; i < 40; i++)
+        durations[keys.at(i)] = double(i % 7) + 0.5;
+
+    for (auto const& weights : {map<string, double>(), durations})
+    {
+        vector<size_t> count(keys.size(), 0);
+        for (size_t index = 1; index <= 3; index++)
+        {
+            auto const selected = TestShard::select("stExample", keys, weights, index, 3);
+            BOOST_CHECK(selected == TestShard::select("stExample", keys, weights, index, 3));
+            BOOST_CHECK(selected.size() > 10);
+            for (size_t const i : selected)
+                count.at(i)++;
+        }
+        for (size_t const c : count)
+            BOOST_CHECK_EQUAL(c, 1);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(testShard_weightsFromHistory)
+{
+    // A --testhistory file can be given to --shardweights, a report is not a history
+    fs::path const history = tempDir() / "history.json";
+    writeFile(history, asBytes(string(R"({ "f/a" : 1500, "f/b" : 250 })")));
+    map<string, double> const times = TestHistory::readTimes(history);
+    BOOST_REQUIRE_EQUAL(times.size(), 2);
+    BOOST_CHECK_EQUAL(times.at("f/a"), 1.5);
+    BOOST_CHECK_EQUAL(times.at("f/b"), 0.25);
+    BOOST_CHECK_THROW(TestReport::read(history), std::exception);
+
+    TestReport report;
+    report.tests["f/a"] = {1, false};
+    fs::path const reportFile = tempDir() / "report.json";
+    report.write(reportFile);
+    BOOST_CHECK_THROW(TestHistory::readTimes(reportFile), std::exception);
+}
+
+BOOST_AUTO_TEST_CASE(testReport_writeReadMerge)
+{
+    TestReport report;
+    report.shard = "1/2";
+    report.testsRun = 3;
+    report.errors = 1;
+    report.failedTests["test1"] = "debug \"info\"\n";
+    report.failedTests["test\\2"] = "C:\\path\\\tend\\";
+    report.tests["suite/folder/test1"] = {1.25, true};
+    report.tests["suite/folder/test2"] = {0.5, false};
+    report.suiteTimes["suite/folder"] = {2, 1, 0.25};
+
+    fs::path const file = tempDir() / "report.json";
+    report.write(file);
+    TestReport read = TestReport::read(file);
+    BOOST_CHECK_EQUAL(read.shard, "1/2");
+    BOOST_CHECK_EQUAL(read.testsRun, 3);
+    BOOST_CHECK_EQUAL(read.errors, 1);
+    BOOST_CHECK_EQUAL(read.failedTests.at("test1"), "debug \"info\"\n");
+    BOOST_CHECK_EQUAL(read.failedTests.at("test\\2"), "C:\\path\\\tend\\");
+    BOOST_CHECK_EQUAL(read.tests.at("suite/folder/test1").time, 1.25);
+    BOOST_CHECK(read.tests.at("suite/folder/test1").failed);
+    BOOST_CHECK(!read.tests.at("suite/folder/test2").failed);
+    BOOST_CHECK_EQUAL(read.suiteTimes.at("suite/folder").t8ntime, 0.25);
+
+    TestReport other;
+    other.testsRun = 2;
+    other.tests["suite/folder/test3"] = {1, false};
+    other.suiteTimes["suite/folder"] = {1, 1, 1};
+    read.merge(other);
+    BOOST_CHECK_EQUAL(read.testsRun, 5);
+    BOOST_CHECK_EQUAL(read.tests.size(), 3);
+    BOOST_CHECK_EQUAL(read.suiteTimes.at("suite/folder").time, 3);
+    BOOST_CHECK_THROW(TestReport::fromData(DataObject(DataType::Object)), std::exception);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
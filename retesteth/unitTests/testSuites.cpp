@@ -1,6 +1,7 @@
 #include "testSuites.h"
 #include <retesteth/EthChecks.h>
 #include <retesteth/Options.h>
+#include <retesteth/helpers/LogSink.h>
 #include <retesteth/helpers/TestHelper.h>
 #include <retesteth/helpers/TestOutputHelper.h>
 #include <retesteth/testSuites/statetests/StateTests.h>
@@ -20,6 +21,7 @@ std::streambuf* oldCoutStreamBuf;
 std::streambuf* oldCerrStreamBuf;
 void interceptOutput()
 {
+    LogSink::get().flush();
     strCout.str("");
     strCout.clear();
     oldCoutStreamBuf = std::cout.rdbuf();
@@ -29,6 +31,7 @@ void interceptOutput()
 }
 void restoreOutput()
 {
+    LogSink::get().flush();
     std::cout.rdbuf(oldCoutStreamBuf);
     std::cerr.rdbuf(oldCerrStreamBuf);
 }
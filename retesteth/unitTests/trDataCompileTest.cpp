@@ -1,6 +1,7 @@
 #include <libdataobj/ConvertFile.h>
 #include <retesteth/Options.h>
 #include <retesteth/helpers/TestOutputHelper.h>
+#include <retesteth/testStructures/Common.h>
 #include <testStructures/types/StateTests/Filler/StateTestFillerTransaction.h>
 
 using namespace std;
@@ -179,4 +180,30 @@ BOOST_AUTO_TEST_CASE(compileSOLCArrayLabel)
     BOOST_CHECK(tr.asDataObject()->atKey("data").at(1).asString().substr(0, 50) == solContractC.substr(0, 50));
 }
 
+BOOST_AUTO_TEST_CASE(collectFillerCode_labels)
+{
+    auto filler = ConvertJsoncppStringToData(R"({
+        "pre" : {
+            "095e7baea6a6c7c4c2dfeb977efac326af552d87" : { "code" : "{ [[0]] 1 }", "balance" : "1" },
+            "a94f5374fce5edbc8e2a8697c15331677e6ebf0b" : { "balance" : "1" }
+        },
+        "transaction" : {
+            "data" : [ ":label first :raw 0x12", { "data" : ":label second { (STOP) }", "accessList" : [] }, ":label empty" ]
+        }
+    })");
+    std::vector<string> const codes = test::teststruct::collectFillerCode(filler);
+    BOOST_REQUIRE_EQUAL(codes.size(), 4);
+    BOOST_CHECK_EQUAL(codes.at(0), "{ [[0]] 1 }");
+    BOOST_CHECK_EQUAL(codes.at(1), ":raw 0x12");
+    BOOST_CHECK_EQUAL(codes.at(2), "{ (STOP) }");
+    BOOST_CHECK(codes.at(3).empty());
+
+    // Sources not compiled by external programs are left to replaceCode
+    test::compiler::PrecompiledCode const precompiled({":raw 0x12", "0x00", ":abi f(uint) 1"});
+    BOOST_CHECK(precompiled.compiled().empty());
+    StateTestFillerTransaction tr = makeTransaction({":label first :raw 0x1234"});
+    BOOST_CHECK(tr.buildTransactions().at(0).transaction()->dataLabel() == ":label first");
+    BOOST_CHECK(tr.asDataObject()->atKey("data").at(0).asString() == "0x1234");
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,55 @@
+#include "TempDirFixture.h"
+#include <libdataobj/ConvertFile.h>
+#include <libdevcore/CommonIO.h>
+#include <retesteth/helpers/TraceSpan.h>
+#include <map>
+#include <set>
+#include <thread>
+
+using namespace std;
+using namespace test;
+using namespace test::unittests;
+using namespace dataobject;
+namespace fs = boost::filesystem;
+
+BOOST_FIXTURE_TEST_SUITE(TraceSuite, TempDirFixture)
+
+BOOST_AUTO_TEST_CASE(traceSpan_writeTrace)
+{
+    bool const wasEnabled = TraceSpan::enabled();
+    TraceSpan::setEnabled(true);
+    {
+        ETH_TRACE_SPAN("traceTestOuter");
+        ETH_TRACE_SPAN("traceTestInner");
+    }
+    std::thread([]() { ETH_TRACE_SPAN("traceTestThread"); }).join();
+    TraceSpan::setEnabled(false);
+    {
+        ETH_TRACE_SPAN("traceTestDisabled");
+    }
+
+    fs::path const file = tempDir() / "trace.json";
+    TraceSpan::writeTrace(file);
+    TraceSpan::setEnabled(wasEnabled);
+    spDataObject const trace = ConvertJsoncppStringToData(dev::contentsString(file));
+
+    std::map<string, int> spans;
+    std::set<int> threads;
+    for (auto const& event : trace->atKey("traceEvents").getSubObjects())
+    {
+        string const& name = event->atKey("name").asString();
+        if (name.find("traceTest") != 0)
+            continue;
+        BOOST_CHECK_EQUAL(event->atKey("ph").asString(), "X");
+        BOOST_CHECK(event->atKey("dur").asInt() >= 0);
+        spans[name]++;
+        threads.emplace(event->atKey("tid").asInt());
+    }
+    BOOST_CHECK_EQUAL(spans["traceTestOuter"], 1);
+    BOOST_CHECK_EQUAL(spans["traceTestInner"], 1);
+    BOOST_CHECK_EQUAL(spans["traceTestThread"], 1);
+    BOOST_CHECK_EQUAL(spans.count("traceTestDisabled"), 0);
+    BOOST_CHECK_EQUAL(threads.size(), 2);
+}
+
+BOOST_AUTO_TEST_SUITE_END()